@@ -6,13 +6,29 @@
 #define BINARY_SEARCH_TREE_HPP
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <memory>
 #include <initializer_list>
 #include <stdexcept>
 #include <algorithm>
+#include <atomic>
+#include <bit>
 #include <ranges>
 #include <compare>
 #include <concepts>
+#include <coroutine>
+#include <exception>
+#include <execution>
+#include <functional>
+#include <future>
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include <unordered_map> // FOR TESTING - REMOVE WHEN FINISHED
 
 #include "binary_tree.hpp"
@@ -22,6 +38,35 @@ namespace adt {
 
     enum class bst_traversals { preorder, inorder, postorder };
 
+    enum class bst_shapes { preserve, balanced };
+
+    struct bst_sorted_unique_t { explicit bst_sorted_unique_t() = default; };
+
+    inline constexpr bst_sorted_unique_t bst_sorted_unique{};
+
+    // How often find() and contains() were answered by a BST's hot-key cache
+    struct bst_cache_stats {
+        std::size_t hits = 0;
+
+        std::size_t lookups = 0;
+
+        [[nodiscard]] constexpr double hit_rate() const noexcept {
+            return (this->lookups == 0) ? 0.0 : static_cast<double>(this->hits) / static_cast<double>(this->lookups);
+        }
+    };
+
+    namespace detail {
+        // Identifies the value type of a serialized BST: the size of a value, plus whether values are integral,
+        // signed or floating point
+        template<class T>
+        constexpr std::uint32_t bst_type_tag() noexcept {
+            return static_cast<std::uint32_t>(sizeof(T)) |
+                   (static_cast<std::uint32_t>(std::is_integral_v<T>) << 16) |
+                   (static_cast<std::uint32_t>(std::is_signed_v<T>) << 17) |
+                   (static_cast<std::uint32_t>(std::is_floating_point_v<T>) << 18);
+        }
+    } // detail
+
     template<class T, class Allocator = std::allocator<T>>
     class binary_search_tree : public binary_tree<T, Allocator> {
     public:
@@ -55,15 +100,57 @@ namespace adt {
 
         using node_allocator_traits = typename binary_tree<T, Allocator>::node_allocator_traits;
 
+        // A direct-mapped cache from hash(value) to the node holding that value. Entries are only ever filled by
+        // find() and contains(), and are dropped whenever their node leaves the BST. Const lookups update it, so
+        // its slots and counters are relaxed atomics that concurrent readers can share
+        struct _HotCache {
+            std::vector<std::atomic<_Node*>> slots;
+
+            // log2 of the number of slots subtracted from 64, for Fibonacci hashing
+            unsigned int shift;
+
+            std::atomic<size_type> hits = 0;
+
+            std::atomic<size_type> lookups = 0;
+        };
+
         /* ------------------------------------------------Fields--------------------------------------------------- */
+        static constexpr size_type parallel_cutoff = 1 << 14;
+
+        // Parallel copies, builds and teardowns share the one node allocator between their threads, which is only safe for an
+        // allocator whose instances are interchangeable; any other allocator keeps them on the calling thread
+        static constexpr bool parallel_allocation = node_allocator_traits::is_always_equal::value;
+
+        static constexpr bool cacheable = requires(const_reference value) {
+            { std::hash<value_type>{}(value) } -> std::convertible_to<std::size_t>;
+        };
+
+        static constexpr char snapshot_magic[8] = {'a', 'd', 't', ':', ':', 'b', 's', 't'};
+
+        static constexpr std::uint32_t snapshot_version = 1;
+
+        // Values are written and read this many at a time
+        static constexpr size_type snapshot_chunk = 1 << 13;
+
+        static constexpr std::uint64_t checksum_basis = 0xcbf29ce484222325;
+
         _Node* min_node;
 
         _Node* max_node;
 
+        // Disabled (nullptr) unless enable_hot_cache() is called; it belongs to this object and is never copied
+        std::unique_ptr<_HotCache> hot_cache;
+
         /* ------------------------------------------------Methods-------------------------------------------------- */
+        static constexpr bool _equivalent(const_reference lhs, const_reference rhs) noexcept {
+            // Searches match values by their ordering rather than by ==, which for a type such as map_entry also
+            // compares more than the part the BST is ordered by
+            return !(lhs < rhs) && !(rhs < lhs);
+        }
+
         static constexpr _Node* _find_target(const_reference value, _Node* curr) noexcept {
             // For each node in the BST that does not contain `value`...
-            while (curr != nullptr && curr->value != value) {
+            while (curr != nullptr && !_equivalent(curr->value, value)) {
                 // If the current node's left child has a value larger than `value` or
                 // the current node's right child has a value smaller than `value`...
                 if ((curr->parent != nullptr) && 
@@ -85,6 +172,15 @@ namespace adt {
             return curr;
         }
 
+        static constexpr void _prefetch(const _Node* node) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            // Ask the CPU to start pulling the node into cache without waiting for it
+            if (node != nullptr) {
+                __builtin_prefetch(node);
+            }
+#endif
+        }
+
         static constexpr _Node* _find_min(_Node* node) noexcept {
             if (node == nullptr) {
                 return nullptr;
@@ -113,7 +209,7 @@ namespace adt {
             // If the node has NO right child...
             if (node->right == nullptr) {
                 // Traverse up the BST until the inorder successor is found
-                while (node->parent != nullptr && node == node->right) {
+                while (node->parent != nullptr && node == node->parent->right) {
                     node = node->parent;
                 }
                 return node->parent;
@@ -339,32 +435,211 @@ namespace adt {
             return curr;
         }
 
-        constexpr std::pair<_Node*, bool> _insert(const_reference value, _Node* curr = nullptr) noexcept {
-            // Insert `value` at the root if the BST is empty
+        [[nodiscard]] constexpr _Node* _get_hint(const _Node* node) const noexcept {
+            // A hint at the end of the BST refers to the position after the maximum node
+            return const_cast<_Node*>((node == nullptr) ? this->max_node : node);
+        }
+
+        [[nodiscard]] constexpr _Node* _find_finger(const_reference value, _Node* hint) const noexcept {
+            // Keys past either end of the BST can be attached to the hint directly
+            if ((hint == this->max_node && value > hint->value) || (hint == this->min_node && value < hint->value)) {
+                return hint;
+            }
+
+            _Node* curr = hint;
+
+            if (value < curr->value) {
+                // Climb until the current subtree's lower bound is below `value`
+                while (curr->parent != nullptr) {
+                    if (curr == curr->parent->right) {
+                        if (curr->parent->value < value) {
+                            return curr;
+                        } else if (!(value < curr->parent->value)) {
+                            return curr->parent;
+                        }
+                    }
+
+                    curr = curr->parent;
+                }
+            } else if (value > curr->value) {
+                // Climb until the current subtree's upper bound is above `value`
+                while (curr->parent != nullptr) {
+                    if (curr == curr->parent->left) {
+                        if (curr->parent->value > value) {
+                            return curr;
+                        } else if (!(value > curr->parent->value)) {
+                            return curr->parent;
+                        }
+                    }
+
+                    curr = curr->parent;
+                }
+            }
+
+            // `value` is bracketed by the current node's subtree, so the search can descend from here
+            return curr;
+        }
+
+        size_type _cache_slot(const_reference value) const noexcept requires(cacheable) {
+            // Multiply by 2^64 / phi so that hashes differing only in their high or low bits still spread out
+            std::uint64_t hash = static_cast<std::uint64_t>(std::hash<value_type>{}(value));
+            return static_cast<size_type>((hash * 0x9e3779b97f4a7c15ull) >> this->hot_cache->shift);
+        }
+
+        constexpr _Node* _lookup(const_reference value) const noexcept {
+            // Try the hot-key cache before descending
+            _HotCache* cache = this->hot_cache.get();
+            size_type slot = 0;
+            if constexpr (cacheable) {
+                if (cache != nullptr) {
+                    cache->lookups.fetch_add(1, std::memory_order_relaxed);
+                    slot = this->_cache_slot(value);
+                    _Node* cached = cache->slots[slot].load(std::memory_order_relaxed);
+                    if (cached != nullptr && _equivalent(cached->value, value)) {
+                        cache->hits.fetch_add(1, std::memory_order_relaxed);
+                        return cached;
+                    }
+                }
+            }
+
+            _Node* curr = this->root;
+            while (curr != nullptr) {
+                if (value < curr->value) {
+                    curr = curr->left;
+                } else if (curr->value < value) {
+                    curr = curr->right;
+                } else {
+                    break;
+                }
+            }
+
+            // Remember where the value was found, evicting whatever shared its slot
+            if (cache != nullptr && curr != nullptr) {
+                cache->slots[slot].store(curr, std::memory_order_relaxed);
+            }
+
+            return curr;
+        }
+
+        constexpr void _forget(const _Node* node) noexcept {
+            // Drop the cache entry for a node that is about to leave the BST
+            if constexpr (cacheable) {
+                if (this->hot_cache != nullptr) {
+                    std::atomic<_Node*>& cached = this->hot_cache->slots[this->_cache_slot(node->value)];
+                    if (cached.load(std::memory_order_relaxed) == node) {
+                        cached.store(nullptr, std::memory_order_relaxed);
+                    }
+                }
+            }
+        }
+
+        constexpr void _forget_all() noexcept {
+            // Drop every cache entry before nodes are released in bulk
+            if (this->hot_cache != nullptr) {
+                for (std::atomic<_Node*>& cached : this->hot_cache->slots) {
+                    cached.store(nullptr, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        template<class... Args>
+        _Node* _construct_in_place(_Node* parent, Args&&... args) {
+            _Node* node = node_allocator_traits::allocate(this->node_allocator, 1);
+
+            // The value is initialized straight from its constructor arguments, with no temporary to copy or move
+            try {
+                ::new (static_cast<void*>(node))
+                    _Node{value_type(std::forward<Args>(args)...), parent, nullptr, nullptr};
+            } catch (...) {
+                node_allocator_traits::deallocate(this->node_allocator, node, 1);
+                throw;
+            }
+
+            return node;
+        }
+
+        template<class V>
+        constexpr _Node* _append(V&& value) noexcept {
+            // Attach `value` as the right child of the maximum node (or as the root of an empty BST)
+            _Node* node = this->_construct_in_place(this->max_node, std::forward<V>(value));
+            if (this->max_node == nullptr) {
+                this->root = this->min_node = node;
+            } else {
+                this->max_node->right = node;
+            }
+
+            this->max_node = node;
+            this->sz++;
+
+            return node;
+        }
+
+        template<class V>
+        constexpr _Node* _prepend(V&& value) noexcept {
+            // Attach `value` as the left child of the minimum node (or as the root of an empty BST)
+            _Node* node = this->_construct_in_place(this->min_node, std::forward<V>(value));
+            if (this->min_node == nullptr) {
+                this->root = this->max_node = node;
+            } else {
+                this->min_node->left = node;
+            }
+
+            this->min_node = node;
+            this->sz++;
+
+            return node;
+        }
+
+        constexpr void _attach(_Node* node, _Node* parent, bool left) noexcept {
+            // Hang a new leaf off `parent` (or make it the root of an empty BST), keeping the extremes current
+            if (parent == nullptr) {
+                this->root = this->min_node = this->max_node = node;
+            } else if (left) {
+                parent->left = node;
+                if (parent == this->min_node) {
+                    this->min_node = node;
+                }
+            } else {
+                parent->right = node;
+                if (parent == this->max_node) {
+                    this->max_node = node;
+                }
+            }
+
+            this->sz++;
+        }
+
+        template<class V>
+        constexpr std::pair<_Node*, bool> _insert(V&& value, _Node* hint = nullptr) noexcept {
+            // Insert `value` at the root if the BST is empty; an rvalue is moved into its node, never copied
             if (this->root == nullptr) {
-                this->root = this->min_node = this->max_node = this->_construct_node(value, nullptr, nullptr, nullptr);
+                this->root = this->_construct_in_place(nullptr, std::forward<V>(value));
+                this->min_node = this->max_node = this->root;
                 this->sz++;
                 return std::make_pair(this->root, true);
             }
 
-            if (curr == nullptr) {
-                curr = this->root;
+            // Without a hint, keys past either end of the BST attach to the cached minimum or
+            // maximum node directly instead of descending from the root
+            if (hint == nullptr) {
+                if (value > this->max_node->value) {
+                    return std::make_pair(this->_append(std::forward<V>(value)), true);
+                } else if (value < this->min_node->value) {
+                    return std::make_pair(this->_prepend(std::forward<V>(value)), true);
+                }
             }
 
+            // Start from the root or, if a hint was given, from the smallest subtree around the hint
+            // that brackets `value` (finger search)
+            _Node* curr = (hint == nullptr) ? this->root : this->_find_finger(value, hint);
+
             // For each node in the BST...
             while (curr != nullptr) {
-                // If the current node is out of place...
-                if ((curr->parent != nullptr) &&
-                    ((curr == curr->parent->left && curr->parent->value < value) ||
-                    (curr == curr->parent->right && curr->parent->value > value))) {
-                    // Traverse back up the BST until all nodes to the left of the current node are less than itself and
-                    // all nodes to the right of current node are greater than itself
-                    curr = curr->parent;
-                } else if (value < curr->value) {
+                if (value < curr->value) {
                     // If the current node has no left child...
                     if (curr->left == nullptr) {
                         // Insert `value` to the left of the current node
-                        curr->left = this->_construct_node(value, curr, nullptr, nullptr);
+                        curr->left = this->_construct_in_place(curr, std::forward<V>(value));
 
                         // Visit the new node and exit the loop
                         curr = curr->left;
@@ -377,7 +652,7 @@ namespace adt {
                     // If the current node has no right child...
                     if (curr->right == nullptr) {
                         // Insert `value` to the right of the current node
-                        curr->right = this->_construct_node(value, curr, nullptr, nullptr);
+                        curr->right = this->_construct_in_place(curr, std::forward<V>(value));
 
                         // Visit the new node and exit the loop
                         curr = curr->right;
@@ -408,6 +683,58 @@ namespace adt {
             return std::make_pair(curr, true);
         }
 
+        constexpr std::pair<_Node*, bool> _link_unique(_Node* node, _Node* hint) noexcept {
+            const_reference value = node->value;
+
+            // Find the leaf position for the new node, the same way _insert() does
+            _Node* parent = nullptr;
+            bool left = false;
+            if (this->root != nullptr) {
+                if (hint == nullptr && value > this->max_node->value) {
+                    parent = this->max_node;
+                } else if (hint == nullptr && value < this->min_node->value) {
+                    parent = this->min_node;
+                    left = true;
+                } else {
+                    for (_Node* curr = (hint == nullptr) ? this->root : this->_find_finger(value, hint);
+                         curr != nullptr;) {
+                        if (value < curr->value) {
+                            parent = curr;
+                            left = true;
+                            curr = curr->left;
+                        } else if (value > curr->value) {
+                            parent = curr;
+                            left = false;
+                            curr = curr->right;
+                        } else {
+                            // The value is already present, so leave the node unlinked for the caller
+                            return std::make_pair(curr, false);
+                        }
+                    }
+                }
+            }
+
+            // Link the node only now that its value is known to be new
+            node->parent = parent;
+            this->_attach(node, parent, left);
+
+            return std::make_pair(node, true);
+        }
+
+        template<class... Args>
+        constexpr std::pair<_Node*, bool> _emplace(_Node* hint, Args&&... args) noexcept {
+            // The value's key is only known once it is constructed, so build it in its node first
+            _Node* node = this->_construct_in_place(nullptr, std::forward<Args>(args)...);
+
+            // If the value is already present, free the new node without ever having linked it
+            std::pair<_Node*, bool> pair = this->_link_unique(node, hint);
+            if (!pair.second) {
+                this->_destroy_node(node);
+            }
+
+            return pair;
+        }
+
         constexpr void _transplant(_Node* const dst, _Node* const src) noexcept {
             // If the destination node is the root node...
             if (dst->parent == nullptr) {
@@ -434,6 +761,8 @@ namespace adt {
                 return nullptr;
             }
 
+            this->_forget(target);
+
             _Node* successor;
 
             if (target->left != nullptr) {
@@ -503,7 +832,7 @@ namespace adt {
                     // Otherwise, find the inorder predecessor and make that the new maximum node
                     this->max_node = this->max_node->left;
                     while (this->max_node->right != nullptr) {
-                        this->max_node = this->max_node->left;
+                        this->max_node = this->max_node->right;
                     }
                 }
             }
@@ -514,6 +843,42 @@ namespace adt {
             return successor;
         }
 
+        constexpr _Node* _remove_min() noexcept {
+            _Node* target = this->min_node;
+            this->_forget(target);
+
+            // The minimum node has no left child, so its right subtree simply takes its place
+            this->_transplant(target, target->right);
+
+            // The new minimum is the leftmost node of that subtree or, if there is none, the parent
+            this->min_node = (target->right != nullptr) ? _find_min(target->right) : target->parent;
+            if (target == this->max_node) {
+                this->max_node = target->parent;
+            }
+
+            this->sz--;
+
+            return target;
+        }
+
+        constexpr _Node* _remove_max() noexcept {
+            _Node* target = this->max_node;
+            this->_forget(target);
+
+            // The maximum node has no right child, so its left subtree simply takes its place
+            this->_transplant(target, target->left);
+
+            // The new maximum is the rightmost node of that subtree or, if there is none, the parent
+            this->max_node = (target->left != nullptr) ? _find_max(target->left) : target->parent;
+            if (target == this->min_node) {
+                this->min_node = target->parent;
+            }
+
+            this->sz--;
+
+            return target;
+        }
+
         constexpr _Node* _erase(_Node* target) noexcept {
             _Node* successor = this->_remove(target);
             this->_destroy_node(target);
@@ -521,14 +886,20 @@ namespace adt {
             return successor;
         }
 
-        constexpr void _clear() noexcept {
-            _Node* curr = this->root;
+        constexpr size_type _destroy_subtree(_Node* curr) noexcept {
+            size_type count = 0;
+
+            // Detach the subtree so that the walk below stops at its root
+            if (curr != nullptr) {
+                curr->parent = nullptr;
+            }
 
             while (curr != nullptr) {
                 // If the current node is a leaf...
                 if (curr->left == nullptr && curr->right == nullptr) {
                     // Delete the current node and point it's address to it's parent node
                     curr = this->_destroy_node(curr);
+                    count++;
                 } else if (curr->left != nullptr) {
                     // Otherwise, if the current node has a left child, then visit the left child
                     curr = curr->left;
@@ -538,45 +909,463 @@ namespace adt {
                 }
             }
 
+            return count;
+        }
+
+        size_type _destroy_subtree(_Node* curr, size_type threads) {
+            // Fall back to a sequential teardown once the thread budget is spent, when the allocator cannot be
+            // shared between threads, or when the subtree does not fork into two independent halves
+            if (!parallel_allocation || curr == nullptr || threads <= 1 || curr->left == nullptr ||
+                curr->right == nullptr) {
+                return this->_destroy_subtree(curr);
+            }
+
+            // Detach both halves so that neither thread touches the shared root
+            _Node* left = curr->left;
+            _Node* right = curr->right;
+            curr->left = curr->right = nullptr;
+
+            // Destroy the left half on a new thread while this thread destroys the right half
+            size_type left_count = 0;
+            std::thread left_thread([&] { left_count = this->_destroy_subtree(left, threads / 2); });
+            size_type right_count = this->_destroy_subtree(right, threads - threads / 2);
+            left_thread.join();
+
+            return left_count + right_count + this->_destroy_subtree(curr);
+        }
+
+        constexpr void _clear() noexcept {
+            this->_forget_all();
+            this->_destroy_subtree(this->root);
+
             this->root = this->min_node = this->max_node = nullptr;
             this->sz = 0;
         }
 
-        constexpr _Node* _copy(_Node* dst_node, _Node* dst_parent, const _Node* src_node, 
-                               const binary_search_tree& src) noexcept {
-            // Base case
-            if (src_node == nullptr) {
+        static constexpr _Node* _link_balanced(_Node* const* nodes, size_type count, _Node* parent) noexcept {
+            if (count == 0) {
+                return nullptr;
+            }
+
+            // Make the middle node the root of this subtree and build both halves below it
+            size_type mid = count / 2;
+            _Node* node = nodes[mid];
+            node->parent = parent;
+            node->left = _link_balanced(nodes, mid, node);
+            node->right = _link_balanced(nodes + mid + 1, count - mid - 1, node);
+
+            return node;
+        }
+
+        template<class Predicate>
+        constexpr size_type _erase_if(Predicate& pred) {
+            std::vector<_Node*> survivors;
+            std::vector<_Node*> victims;
+            survivors.reserve(this->sz);
+
+            // Sort every node into survivors and victims with a single inorder pass
+            for (_Node* curr = this->min_node; curr != nullptr; curr = _inorder_forward_traverse(curr)) {
+                if (pred(std::as_const(curr->value))) {
+                    victims.push_back(curr);
+                } else {
+                    survivors.push_back(curr);
+                }
+            }
+
+            if (victims.empty()) {
+                return 0;
+            }
+
+            // Free the victims in one batch; their links are stale, so detach them first
+            this->_forget_all();
+            for (_Node* victim : victims) {
+                victim->parent = victim->left = victim->right = nullptr;
+                this->_destroy_node(victim);
+            }
+
+            // Relink the survivors into a balanced BST
+            this->root = _link_balanced(survivors.data(), survivors.size(), nullptr);
+            this->min_node = survivors.empty() ? nullptr : survivors.front();
+            this->max_node = survivors.empty() ? nullptr : survivors.back();
+            this->sz = survivors.size();
+
+            return victims.size();
+        }
+
+        static constexpr std::pair<_Node*, _Node*> _split(_Node* curr, const_reference key) noexcept {
+            _Node* less = nullptr;
+            _Node* greater = nullptr;
+            _Node** less_link = &less;
+            _Node** greater_link = &greater;
+            _Node* less_parent = nullptr;
+            _Node* greater_parent = nullptr;
+
+            // Walk down the search path for `key`, handing each node to the side it belongs to. Nodes
+            // less than `key` keep their left subtrees and hang off the previous "less" node's right link;
+            // the remaining nodes keep their right subtrees and hang off the previous "greater" node's left link
+            while (curr != nullptr) {
+                if (curr->value < key) {
+                    *less_link = curr;
+                    curr->parent = less_parent;
+                    less_parent = curr;
+                    less_link = &curr->right;
+                    curr = curr->right;
+                } else {
+                    *greater_link = curr;
+                    curr->parent = greater_parent;
+                    greater_parent = curr;
+                    greater_link = &curr->left;
+                    curr = curr->left;
+                }
+            }
+
+            *less_link = nullptr;
+            *greater_link = nullptr;
+
+            return std::make_pair(less, greater);
+        }
+
+        constexpr _Node* _erase_range(_Node* first, _Node* last) noexcept {
+            // Split off everything before `first`, then everything from `last` onwards
+            std::pair<_Node*, _Node*> lower = _split(this->root, first->value);
+            std::pair<_Node*, _Node*> upper = (last == nullptr) ? std::make_pair(lower.second, nullptr)
+                                                                : _split(lower.second, last->value);
+
+            // Discard the middle part in one pass
+            this->_forget_all();
+            this->sz -= this->_destroy_subtree(upper.first);
+
+            // Join the two remaining parts; every node on the left is less than every node on the right
+            _Node* lower_max = _find_max(lower.first);
+            if (lower.first == nullptr) {
+                this->root = upper.second;
+            } else {
+                this->root = lower.first;
+                lower_max->right = upper.second;
+                if (upper.second != nullptr) {
+                    upper.second->parent = lower_max;
+                }
+            }
+
+            // Update the minimum and maximum nodes (if needed)
+            if (lower.first == nullptr) {
+                this->min_node = last;
+            }
+            if (upper.second == nullptr) {
+                this->max_node = lower_max;
+            }
+
+            return last;
+        }
+
+        constexpr _Node* _release_nodes() noexcept {
+            // Unlink every node, leaves first, and chain them through their right links for reuse
+            this->_forget_all();
+            _Node* pool = nullptr;
+            _Node* curr = this->root;
+            while (curr != nullptr) {
+                if (curr->left != nullptr) {
+                    curr = curr->left;
+                } else if (curr->right != nullptr) {
+                    curr = curr->right;
+                } else {
+                    _Node* parent = curr->parent;
+                    if (parent != nullptr) {
+                        ((curr == parent->left) ? parent->left : parent->right) = nullptr;
+                    }
+
+                    curr->parent = nullptr;
+                    curr->right = pool;
+                    pool = curr;
+                    curr = parent;
+                }
+            }
+
+            this->root = this->min_node = this->max_node = nullptr;
+            this->sz = 0;
+
+            return pool;
+        }
+
+        constexpr _Node* _reuse_node(_Node*& pool, const_reference value, _Node* parent) {
+            // Allocate only once the released nodes run out
+            if (pool == nullptr) {
+                return this->_construct_node(value, parent, nullptr, nullptr);
+            }
+
+            _Node* node = pool;
+            pool = node->right;
+
+            // Overwrite the old value, which lets values such as strings keep their own buffers; values that
+            // cannot be assigned (such as map entries with a const key) are rebuilt in the same storage
+            if constexpr (std::is_copy_assignable_v<value_type>) {
+                node->value = value;
+            } else {
+                std::destroy_at(std::addressof(node->value));
+                std::construct_at(std::addressof(node->value), value);
+            }
+
+            node->parent = parent;
+            node->left = node->right = nullptr;
+
+            return node;
+        }
+
+        constexpr void _free_nodes(_Node* pool) noexcept {
+            // Free whatever an assignment did not need
+            while (pool != nullptr) {
+                _Node* next = pool->right;
+                pool->right = nullptr;
+                this->_destroy_node(pool);
+                pool = next;
+            }
+        }
+
+        constexpr _Node* _copy_subtree(const _Node* src_root, _Node* dst_parent) {
+            _Node* pool = nullptr;
+            return this->_copy_subtree(src_root, dst_parent, pool);
+        }
+
+        constexpr _Node* _copy_subtree(const _Node* src_root, _Node* dst_parent, _Node*& pool) {
+            // Copy the source subtree in preorder without recursion, using the parent links of both
+            // BSTs to climb back up once a node's subtrees have been copied. Nodes come from `pool` while it lasts
+            const _Node* src_node = src_root;
+            _Node* dst_root = this->_reuse_node(pool, src_root->value, dst_parent);
+            _Node* dst_node = dst_root;
+
+            try {
+                while (true) {
+                    if (src_node->left != nullptr && dst_node->left == nullptr) {
+                        // Copy the left child and visit it
+                        dst_node->left = this->_reuse_node(pool, src_node->left->value, dst_node);
+                        src_node = src_node->left;
+                        dst_node = dst_node->left;
+                    } else if (src_node->right != nullptr && dst_node->right == nullptr) {
+                        // Copy the right child and visit it
+                        dst_node->right = this->_reuse_node(pool, src_node->right->value, dst_node);
+                        src_node = src_node->right;
+                        dst_node = dst_node->right;
+                    } else if (src_node == src_root) {
+                        // Both subtrees of the subtree's root have been copied
+                        break;
+                    } else {
+                        // Both subtrees have been copied, so go back up
+                        src_node = src_node->parent;
+                        dst_node = dst_node->parent;
+                    }
+                }
+            } catch (...) {
+                // A value copy threw, so free the part of the copy built so far
+                this->_destroy_subtree(dst_root);
+                throw;
+            }
+
+            return dst_root;
+        }
+
+        template<class Left, class Right>
+        static void _fork(Left&& left, Right&& right) {
+            // Run `left` on a new thread while this thread runs `right`. The new thread is joined even when
+            // `right` throws, and an exception thrown by either half is rethrown here once both have finished
+            std::exception_ptr left_error;
+            std::thread left_thread([&] {
+                try {
+                    left();
+                } catch (...) {
+                    left_error = std::current_exception();
+                }
+            });
+
+            std::exception_ptr right_error;
+            try {
+                right();
+            } catch (...) {
+                right_error = std::current_exception();
+            }
+            left_thread.join();
+
+            if (left_error) {
+                std::rethrow_exception(left_error);
+            }
+            if (right_error) {
+                std::rethrow_exception(right_error);
+            }
+        }
+
+        _Node* _copy_subtree(const _Node* src_root, _Node* dst_parent, size_type count, size_type threads) {
+            // Fall back to a sequential copy once the thread budget is spent, when the allocator cannot be shared,
+            // when the subtree is too small to be worth a thread, or when it does not fork into two independent
+            // halves. Nodes do not record the size of their subtrees, so `count` assumes every fork splits evenly
+            if (!parallel_allocation || threads <= 1 || count < parallel_cutoff || src_root->left == nullptr ||
+                src_root->right == nullptr) {
+                return this->_copy_subtree(src_root, dst_parent);
+            }
+
+            _Node* dst_root = this->_construct_node(src_root->value, dst_parent, nullptr, nullptr);
+
+            try {
+                // Copy the left subtree on a new thread while this thread copies the right subtree
+                this->_fork(
+                    [&] { dst_root->left = this->_copy_subtree(src_root->left, dst_root, count / 2, threads / 2); },
+                    [&] {
+                        dst_root->right = this->_copy_subtree(src_root->right, dst_root, count / 2, 
+                                                              threads - threads / 2);
+                    });
+            } catch (...) {
+                // Free whichever half was copied, along with the root
+                this->_destroy_subtree(dst_root);
+                throw;
+            }
+
+            return dst_root;
+        }
+
+        constexpr void _copy(const binary_search_tree& src) noexcept {
+            _Node* pool = nullptr;
+            this->_copy(src, pool);
+        }
+
+        constexpr void _copy(const binary_search_tree& src, _Node*& pool) noexcept {
+            this->root = (src.root != nullptr) ? this->_copy_subtree(src.root, nullptr, pool) : nullptr;
+            this->min_node = _find_min(this->root);
+            this->max_node = _find_max(this->root);
+            this->sz = src.sz;
+        }
+
+        void _copy(const binary_search_tree& src, size_type threads) {
+            this->root = (src.root != nullptr) ? this->_copy_subtree(src.root, nullptr, src.sz, threads) : nullptr;
+            this->min_node = _find_min(this->root);
+            this->max_node = _find_max(this->root);
+            this->sz = src.sz;
+        }
+
+        template<std::random_access_iterator RandomIt>
+        _Node* _build_sorted(RandomIt first, size_type count, _Node* parent, size_type threads) {
+            if (count == 0) {
                 return nullptr;
             }
 
-            // Copy the current node from the source BST
-            dst_node = this->_construct_node(src_node->value, dst_parent, nullptr, nullptr);
-
-            // If the current node from the source BST is in the only node...
-            if (src_node->parent == nullptr && src_node->left == nullptr && src_node->right == nullptr) {
-                // Point the destination BST's  minimum and maximum nodes to that node's copy
-                // (i.e. `dst_node`)
-                this->min_node = this->max_node = dst_node;
-            } else if (src_node == src.max_node) {
-                // Otherwise, if the current node from the source BST is the maximum node,
-                // then point the destination BST's maximum node to that node's copy
-                // (i.e. `dst_node`)
-                this->max_node = dst_node;
-            } else if (src_node == src.min_node) {
-                // Otherwise, if the current node from the source BST is the minimum node,
-                // then point the destination BST's minimum node to that node's copy
-                // (i.e. `dst_node`)
-                this->min_node = dst_node;
-            }
-           
-            // Continue copying the rest of the source BST
-            dst_node->left = this->_copy(dst_node->left, dst_node, src_node->left, src);
-            dst_node->right = this->_copy(dst_node->right, dst_node, src_node->right, src);
+            // Make the middle value the root of this subtree and build both halves below it
+            size_type mid = count / 2;
+            _Node* node = this->_construct_node(first[mid], parent, nullptr, nullptr);
+
+            try {
+                // Small subtrees are not worth the cost of starting a thread, and a stateful allocator stays on one
+                if (!parallel_allocation || threads <= 1 || count < parallel_cutoff) {
+                    node->left = this->_build_sorted(first, mid, node, 1);
+                    node->right = this->_build_sorted(first + mid + 1, count - mid - 1, node, 1);
+                } else {
+                    // Build the left half on a new thread while this thread builds the right half
+                    this->_fork(
+                        [&] { node->left = this->_build_sorted(first, mid, node, threads / 2); },
+                        [&] {
+                            node->right = this->_build_sorted(first + mid + 1, count - mid - 1, node, 
+                                                              threads - threads / 2);
+                        });
+                }
+            } catch (...) {
+                // A value copy threw somewhere below, so free whatever was built under this node
+                this->_destroy_subtree(node);
+                throw;
+            }
+
+            return node;
+        }
+
+        template<std::random_access_iterator RandomIt>
+        void _build_sorted(RandomIt first, RandomIt last, size_type threads) {
+            // Create an empty tree if `last` is not reachable from `first`
+            size_type count = (last - first > 0) ? static_cast<size_type>(last - first) : 0;
+
+            this->root = this->_build_sorted(first, count, nullptr, threads);
+            this->min_node = _find_min(this->root);
+            this->max_node = _find_max(this->root);
+            this->sz = count;
+        }
+
+        static std::uint64_t _checksum(std::uint64_t checksum, const char* bytes, size_type count) noexcept {
+            // FNV-1a over 64-bit words rather than bytes; a trailing partial word is zero-padded
+            for (size_type i = 0; i < count; i += sizeof(std::uint64_t)) {
+                std::uint64_t word = 0;
+                std::memcpy(&word, bytes + i, std::min(sizeof(std::uint64_t), count - i));
+                checksum = (checksum ^ word) * 0x100000001b3;
+            }
+
+            return checksum;
+        }
+
+        template<class Field>
+        static void _write_field(std::ostream& os, const Field& field) {
+            os.write(reinterpret_cast<const char*>(&field), sizeof(Field));
+        }
+
+        static void _read_bytes(std::istream& is, char* bytes, size_type count) {
+            if (!is.read(bytes, static_cast<std::streamsize>(count))) {
+                throw std::runtime_error("adt::binary_search_tree::load() error: the snapshot is truncated");
+            }
+        }
+
+        template<class Field>
+        static void _read_field(std::istream& is, Field& field) {
+            _read_bytes(is, reinterpret_cast<char*>(&field), sizeof(Field));
+        }
+
+        template<class ExecutionPolicy>
+        static size_type _thread_count(size_type thread_count) noexcept {
+            using policy_type = std::remove_cvref_t<ExecutionPolicy>;
+
+            // Sequenced policies never fork
+            if (std::is_same_v<policy_type, std::execution::sequenced_policy> || 
+                std::is_same_v<policy_type, std::execution::unsequenced_policy>) {
+                return 1;
+            }
+
+            // Otherwise use the requested number of threads, or one per hardware thread
+            if (thread_count == 0) {
+                thread_count = std::thread::hardware_concurrency();
+            }
+            
+            return std::max<size_type>(thread_count, 1);
+        }
+
+        constexpr _Node* _copy_balanced(const _Node*& src_node, size_type count, _Node* dst_parent) noexcept {
+            if (count == 0) {
+                return nullptr;
+            }
+
+            // Build the left half first so that nodes are copied (and allocated) in inorder
+            size_type left_count = count / 2;
+            _Node* left = this->_copy_balanced(src_node, left_count, nullptr);
+            _Node* dst_node = this->_construct_node(src_node->value, dst_parent, left, nullptr);
+            if (left != nullptr) {
+                left->parent = dst_node;
+            }
+
+            src_node = _inorder_forward_traverse(const_cast<_Node*>(src_node));
+            dst_node->right = this->_copy_balanced(src_node, count - left_count - 1, dst_node);
 
             return dst_node;
         }
 
+        constexpr void _copy(const binary_search_tree& src, bst_shapes shape) noexcept {
+            if (shape == bst_shapes::preserve) {
+                this->_copy(src);
+                return;
+            }
+
+            // Only the recursion depth of a balanced BST (log n) is needed here
+            const _Node* src_node = src.min_node;
+            this->root = this->_copy_balanced(src_node, src.sz, nullptr);
+            this->min_node = _find_min(this->root);
+            this->max_node = _find_max(this->root);
+            this->sz = src.sz;
+        }
+
         constexpr void _move(binary_search_tree& other) noexcept {
+            // The nodes change hands, but each BST keeps its own cache
+            this->_forget_all();
+            other._forget_all();
+
             // If the other BST is empty...
             if (other.root == nullptr) {
                 // Point this BST's root, min, and max nodes to nullptr and set the size to 0
@@ -626,7 +1415,10 @@ namespace adt {
 
             /* ------------------------------------------Constructors----------------------------------------------- */
             constexpr const_iterator(const _Node* const& node, const binary_search_tree* bst_p = nullptr) noexcept
-                : binary_tree<T, Allocator>::const_iterator(node) { this->bst_p = bst_p; }
+                : binary_tree<T, Allocator>::const_iterator(node) {
+                this->bst_p = bst_p;
+                this->traversal = bst_traversals::inorder;
+            }
 
         public:
             /* ------------------------------------------Constructors----------------------------------------------- */
@@ -939,7 +1731,10 @@ namespace adt {
 
             /* ------------------------------------------Constructors----------------------------------------------- */
             constexpr iterator(_Node* const& node, const binary_search_tree* bst_p = nullptr) noexcept
-                : binary_tree<T, Allocator>::iterator(node) { this->bst_p = bst_p;}
+                : binary_tree<T, Allocator>::iterator(node) {
+                this->bst_p = bst_p;
+                this->traversal = bst_traversals::inorder;
+            }
 
         public:
             /* ------------------------------------------Constructors----------------------------------------------- */
@@ -1248,7 +2043,10 @@ namespace adt {
 
             /* ------------------------------------------Constructors----------------------------------------------- */
             constexpr const_reverse_iterator(const _Node* const& node, const binary_search_tree* bst_p = nullptr) noexcept
-                : binary_tree<T, Allocator>::const_reverse_iterator(node) { this->bst_p = bst_p; }
+                : binary_tree<T, Allocator>::const_reverse_iterator(node) {
+                this->bst_p = bst_p;
+                this->traversal = bst_traversals::inorder;
+            }
 
         public:
             /* ------------------------------------------Constructors----------------------------------------------- */
@@ -1551,7 +2349,10 @@ namespace adt {
 
             /* ------------------------------------------Constructors----------------------------------------------- */
             constexpr reverse_iterator(_Node* const& node, const binary_search_tree* bst_p = nullptr) noexcept
-                : binary_tree<T, Allocator>::reverse_iterator(node) { this->bst_p = bst_p; }
+                : binary_tree<T, Allocator>::reverse_iterator(node) {
+                this->bst_p = bst_p;
+                this->traversal = bst_traversals::inorder;
+            }
 
         public:
             /* ------------------------------------------Constructors----------------------------------------------- */
@@ -1918,6 +2719,168 @@ namespace adt {
 
         };
 
+        /* ------------------------------------------------Find Task------------------------------------------------ */
+        class find_task {
+        private:
+            /* --------------------------------------------Friends-------------------------------------------------- */
+            friend class binary_search_tree;
+
+        public:
+            /* -------------------------------------------Promise Type---------------------------------------------- */
+            class promise_type {
+            private:
+                /* ------------------------------------------Friends------------------------------------------------ */
+                friend class find_task;
+
+                /* ------------------------------------------Fields------------------------------------------------- */
+                const_iterator result;
+
+                std::coroutine_handle<> continuation;
+
+            public:
+                /* ------------------------------------------Methods------------------------------------------------ */
+                [[nodiscard]] find_task get_return_object() noexcept {
+                    return find_task(std::coroutine_handle<promise_type>::from_promise(*this));
+                }
+
+                [[nodiscard]] std::suspend_always initial_suspend() const noexcept { return {}; }
+
+                [[nodiscard]] auto final_suspend() const noexcept {
+                    struct final_awaiter {
+                        [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+                        [[nodiscard]] std::coroutine_handle<> await_suspend(
+                            std::coroutine_handle<promise_type> handle) const noexcept {
+                            // Hand control back to the awaiting coroutine (if there is one)
+                            if (handle.promise().continuation) {
+                                return handle.promise().continuation;
+                            }
+
+                            return std::noop_coroutine();
+                        }
+
+                        constexpr void await_resume() const noexcept {}
+                    };
+
+                    return final_awaiter();
+                }
+
+                void return_value(const_iterator it) noexcept { this->result = it; }
+
+                void unhandled_exception() const noexcept { std::terminate(); }
+            };
+
+        private:
+            /* ---------------------------------------------Fields-------------------------------------------------- */
+            std::coroutine_handle<promise_type> handle;
+
+            /* ------------------------------------------Definitions------------------------------------------------ */
+            struct prefetch_awaiter {
+                const _Node* node;
+
+                [[nodiscard]] bool await_ready() const noexcept {
+                    // Start fetching the next node before deciding whether to suspend
+                    _prefetch(this->node);
+                    return this->node == nullptr;
+                }
+
+                [[nodiscard]] bool await_suspend(std::coroutine_handle<promise_type> handle) const noexcept {
+                    // Only yield when a scheduler is driving the lookup; a lookup that is being
+                    // awaited by another coroutine runs straight through to completion
+                    return !handle.promise().continuation;
+                }
+
+                constexpr void await_resume() const noexcept {}
+            };
+
+            /* ------------------------------------------Constructors----------------------------------------------- */
+            explicit find_task(std::coroutine_handle<promise_type> handle) noexcept : handle(handle) {}
+
+        public:
+            /* ------------------------------------------Constructors----------------------------------------------- */
+            find_task() noexcept : handle(nullptr) {}
+
+            find_task(const find_task&) = delete;
+
+            find_task(find_task&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+
+            /* -------------------------------------------Destructor------------------------------------------------ */
+            ~find_task() noexcept {
+                if (this->handle) {
+                    this->handle.destroy();
+                }
+            }
+
+            /* ---------------------------------------Overloaded Operators------------------------------------------ */
+            find_task& operator=(const find_task&) = delete;
+
+            find_task& operator=(find_task&& rhs) noexcept {
+                if (this != &rhs) {
+                    if (this->handle) {
+                        this->handle.destroy();
+                    }
+                    this->handle = std::exchange(rhs.handle, nullptr);
+                }
+
+                return *this;
+            }
+
+            [[nodiscard]] auto operator co_await() && noexcept {
+                struct awaiter {
+                    std::coroutine_handle<promise_type> handle;
+
+                    [[nodiscard]] bool await_ready() const noexcept { return !this->handle || this->handle.done(); }
+
+                    [[nodiscard]] std::coroutine_handle<> await_suspend(std::coroutine_handle<> caller) const noexcept {
+                        // Run the lookup and resume the caller once it has finished
+                        this->handle.promise().continuation = caller;
+                        return this->handle;
+                    }
+
+                    [[nodiscard]] const_iterator await_resume() const noexcept {
+                        return this->handle ? this->handle.promise().result : const_iterator(nullptr);
+                    }
+                };
+
+                return awaiter{this->handle};
+            }
+
+            /* ---------------------------------------------Methods------------------------------------------------- */
+            [[nodiscard]] bool done() const noexcept { return !this->handle || this->handle.done(); }
+
+            bool resume() {
+                if (this->done()) {
+                    return false;
+                }
+
+                // Advance the lookup by one node
+                this->handle.resume();
+                return !this->handle.done();
+            }
+
+            [[nodiscard]] const_iterator get() const {
+                if (!this->done()) {
+                    throw std::runtime_error("adt::binary_search_tree::find_task::get() error: lookup has not finished");
+                }
+
+                return this->handle ? this->handle.promise().result : const_iterator(nullptr);
+            }
+
+        };
+
+    protected:
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        [[nodiscard]] constexpr iterator _make_iterator(_Node* node) const noexcept { return iterator(node, this); }
+
+        [[nodiscard]] constexpr const_iterator _make_const_iterator(const _Node* node) const noexcept {
+            return const_iterator(node, this);
+        }
+
+        [[nodiscard]] static constexpr _Node* _node_of(const_iterator it) noexcept {
+            return const_cast<_Node*>(it.node);
+        }
+
+    public:
         /* ---------------------------------------------Constructors------------------------------------------------ */
         constexpr binary_search_tree() noexcept : binary_tree<T, Allocator>() {
             this->min_node = this->max_node = nullptr;
@@ -1975,13 +2938,35 @@ namespace adt {
         }
 
         constexpr binary_search_tree(const binary_search_tree& other) noexcept : binary_tree<T, Allocator>() {
-            this->min_node = this->max_node = nullptr;
-            this->root = this->_copy(this->root, nullptr, other.root, other);
-            this->sz = other.sz;
+            this->_copy(other);
         }
 
+        constexpr binary_search_tree(const binary_search_tree& other, bst_shapes shape) noexcept 
+            : binary_tree<T, Allocator>() { this->_copy(other, shape); }
+
         constexpr binary_search_tree(const binary_search_tree& other, const allocator_type& allocator) noexcept 
-            : binary_tree<T, Allocator>(allocator) { this->binary_search_tree(other); }
+            : binary_tree<T, Allocator>(allocator) { this->_copy(other); }
+
+        template<class ExecutionPolicy>
+        binary_search_tree(ExecutionPolicy&&, const binary_search_tree& other, size_type thread_count = 0)
+            requires(std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>)
+            : binary_tree<T, Allocator>(
+                  std::allocator_traits<allocator_type>::select_on_container_copy_construction(other.get_allocator())) {
+            this->_copy(other, _thread_count<ExecutionPolicy>(thread_count));
+        }
+
+        template<std::random_access_iterator RandomIt>
+        binary_search_tree(bst_sorted_unique_t, RandomIt first, RandomIt last) : binary_tree<T, Allocator>() {
+            this->_build_sorted(first, last, 1);
+        }
+
+        template<class ExecutionPolicy, std::random_access_iterator RandomIt>
+        binary_search_tree(ExecutionPolicy&&, bst_sorted_unique_t, RandomIt first, RandomIt last, 
+                           size_type thread_count = 0)
+            requires(std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>) 
+            : binary_tree<T, Allocator>() {
+            this->_build_sorted(first, last, _thread_count<ExecutionPolicy>(thread_count));
+        }
 
         constexpr binary_search_tree(binary_search_tree&& other) noexcept 
             : binary_tree<T, Allocator>() { this->_move(other); }
@@ -1999,9 +2984,10 @@ namespace adt {
                 return *this;
             }
 
-            this->_clear();
-            this->root = this->_copy(this->root, nullptr, rhs.root, rhs);
-            this->sz = rhs.sz;
+            // Copy into the nodes this BST already owns, allocating only the shortfall and freeing only the surplus
+            _Node* pool = this->_release_nodes();
+            this->_copy(rhs, pool);
+            this->_free_nodes(pool);
 
             return *this;
         }
@@ -2019,11 +3005,17 @@ namespace adt {
         }
         
         constexpr binary_search_tree& operator=(std::initializer_list<value_type> rhs) noexcept {
-            this->_clear();
+            _Node* pool = this->_release_nodes();
             
             for (typename std::initializer_list<value_type>::iterator it = rhs.begin(); it != rhs.end(); it++) {
-                this->_insert(*it);
+                // Insert each value in a recycled node, and put the node back if the value is a duplicate
+                _Node* node = this->_reuse_node(pool, *it, nullptr);
+                if (!this->_link_unique(node, nullptr).second) {
+                    node->right = pool;
+                    pool = node;
+                }
             }
+            this->_free_nodes(pool);
             
             return *this;
         }
@@ -2075,7 +3067,7 @@ namespace adt {
             return const_iterator(*this, traversal);
         }
 
-        [[nodiscard]] constexpr const_iterator cend() const noexcept { return const_iterator(nullptr); }
+        [[nodiscard]] constexpr const_iterator cend() const noexcept { return const_iterator(nullptr, this); }
 
         [[nodiscard]] constexpr iterator begin() const noexcept { return iterator(*this); }
 
@@ -2083,7 +3075,7 @@ namespace adt {
             return iterator(*this, traversal);
         }
 
-        [[nodiscard]] constexpr iterator end() const noexcept { return iterator(nullptr); }
+        [[nodiscard]] constexpr iterator end() const noexcept { return iterator(nullptr, this); }
 
         [[nodiscard]] constexpr const_reverse_iterator crbegin() const noexcept {
             return const_reverse_iterator(*this);
@@ -2094,7 +3086,7 @@ namespace adt {
         }
 
         [[nodiscard]] constexpr const_reverse_iterator crend() const noexcept {
-            return const_reverse_iterator(nullptr);
+            return const_reverse_iterator(nullptr, this);
         }
 
         [[nodiscard]] constexpr reverse_iterator rbegin() const noexcept { return reverse_iterator(*this); }
@@ -2103,7 +3095,7 @@ namespace adt {
             return reverse_iterator(*this, traversal);
         }
 
-        [[nodiscard]] constexpr reverse_iterator rend() const noexcept { return reverse_iterator(nullptr); }
+        [[nodiscard]] constexpr reverse_iterator rend() const noexcept { return reverse_iterator(nullptr, this); }
 
         [[nodiscard]] constexpr node_type get_root() const noexcept { return node_type(this->root); }
 
@@ -2113,52 +3105,177 @@ namespace adt {
 
         constexpr virtual void clear() noexcept override { this->_clear(); }
 
+        template<class ExecutionPolicy>
+        void clear(ExecutionPolicy&&, size_type thread_count = 0)
+            requires(std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>) {
+            this->_forget_all();
+            this->_destroy_subtree(this->root, _thread_count<ExecutionPolicy>(thread_count));
+
+            this->root = this->min_node = this->max_node = nullptr;
+            this->sz = 0;
+        }
+
+        std::future<size_type> clear_async() {
+            // Hand every node over to a detached BST, leaving this BST empty
+            std::packaged_task<size_type()> reclaimer([detached = binary_search_tree(std::move(*this))]() mutable {
+                size_type count = detached.sz;
+                detached._clear();
+                return count;
+            });
+            std::future<size_type> future = reclaimer.get_future();
+
+            // Destroy the detached BST on a background thread; unlike std::async, the returned future does 
+            // not block when it is discarded
+            std::thread(std::move(reclaimer)).detach();
+
+            return future;
+        }
+
+        void save(std::ostream& os) const requires(std::is_trivially_copyable_v<value_type>) {
+            std::uint32_t version = snapshot_version;
+            std::uint32_t tag = detail::bst_type_tag<value_type>();
+            std::uint64_t count = this->sz;
+
+            // Header: magic, format version, value type tag and value count
+            os.write(snapshot_magic, sizeof(snapshot_magic));
+            _write_field(os, version);
+            _write_field(os, tag);
+            _write_field(os, count);
+
+            std::vector<value_type> chunk;
+            chunk.reserve(snapshot_chunk);
+            std::uint64_t checksum = checksum_basis;
+
+            auto write_chunk = [&] {
+                const char* bytes = reinterpret_cast<const char*>(chunk.data());
+                size_type byte_count = chunk.size() * sizeof(value_type);
+
+                checksum = _checksum(checksum, bytes, byte_count);
+                os.write(bytes, static_cast<std::streamsize>(byte_count));
+                chunk.clear();
+            };
+
+            // Payload: the values in order, a chunk at a time
+            for (_Node* curr = this->min_node; curr != nullptr; curr = _inorder_forward_traverse(curr)) {
+                chunk.push_back(curr->value);
+                if (chunk.size() == snapshot_chunk) {
+                    write_chunk();
+                }
+            }
+            write_chunk();
+
+            // Trailer: the payload checksum, which lets the payload be streamed in a single pass
+            _write_field(os, checksum);
+
+            if (!os) {
+                throw std::runtime_error("adt::binary_search_tree::save() error: the stream could not be written");
+            }
+        }
+
+        void load(std::istream& is)
+            requires(std::is_trivially_copyable_v<value_type> && std::is_default_constructible_v<value_type>) {
+            char magic[sizeof(snapshot_magic)];
+            std::uint32_t version;
+            std::uint32_t tag;
+            std::uint64_t count;
+
+            // Validate the header before reading any values
+            _read_bytes(is, magic, sizeof(magic));
+            if (!std::equal(magic, magic + sizeof(magic), snapshot_magic)) {
+                throw std::runtime_error("adt::binary_search_tree::load() error: the stream is not a BST snapshot");
+            }
+
+            _read_field(is, version);
+            if (version != snapshot_version) {
+                throw std::runtime_error("adt::binary_search_tree::load() error: unsupported snapshot version");
+            }
+
+            _read_field(is, tag);
+            if (tag != detail::bst_type_tag<value_type>()) {
+                throw std::runtime_error("adt::binary_search_tree::load() error: the snapshot holds a different type");
+            }
+
+            _read_field(is, count);
+
+            // Read the payload a chunk at a time; a corrupt count cannot reserve more than one chunk up front
+            std::vector<value_type> values;
+            values.reserve(std::min<std::uint64_t>(count, snapshot_chunk));
+            std::uint64_t checksum = checksum_basis;
+
+            for (std::uint64_t read = 0; read < count;) {
+                size_type n = std::min<std::uint64_t>(count - read, snapshot_chunk);
+                size_type offset = values.size();
+                values.resize(offset + n);
+
+                char* bytes = reinterpret_cast<char*>(values.data() + offset);
+                _read_bytes(is, bytes, n * sizeof(value_type));
+                checksum = _checksum(checksum, bytes, n * sizeof(value_type));
+                read += n;
+            }
+
+            std::uint64_t expected;
+            _read_field(is, expected);
+            if (expected != checksum) {
+                throw std::runtime_error("adt::binary_search_tree::load() error: checksum mismatch");
+            }
+
+            // The sorted bulk build relies on strictly increasing values
+            auto not_increasing = [](const_reference lhs, const_reference rhs) { return !(lhs < rhs); };
+            if (std::adjacent_find(values.begin(), values.end(), not_increasing) != values.end()) {
+                throw std::runtime_error("adt::binary_search_tree::load() error: the values are not sorted and unique");
+            }
+
+            // Build in O(n), replacing this BST's contents only once the whole snapshot has been validated
+            binary_search_tree loaded(bst_sorted_unique, values.begin(), values.end());
+            this->swap(loaded);
+        }
+
         constexpr std::pair<iterator, bool> insert(const_reference value) noexcept
             requires(std::is_copy_constructible_v<value_type>) {
             std::pair<_Node*, bool> pair = this->_insert(value);
-            return std::make_pair(iterator(pair.first), pair.second);
+            return std::make_pair(iterator(pair.first, this), pair.second);
         }
 
         constexpr std::pair<iterator, bool> insert(value_type&& value) noexcept
             requires(std::is_move_constructible_v<value_type>) {
-            std::pair<_Node*, bool> pair = this->_insert(value);
-            return std::make_pair(iterator(pair.first), pair.second);
+            std::pair<_Node*, bool> pair = this->_insert(std::move(value));
+            return std::make_pair(iterator(pair.first, this), pair.second);
         }
 
         constexpr iterator insert(iterator pos, const_reference value) noexcept
             requires(std::is_copy_constructible_v<value_type> && !std::is_same_v<iterator, const_iterator>) {
             if (pos.bst_p != this) {
-                return iterator(this->_insert(value, this->root).first);
+                return iterator(this->_insert(value, this->root).first, this);
             }
 
-            return iterator(this->_insert(value, const_cast<_Node*>(pos.node)).first);
+            return iterator(this->_insert(value, this->_get_hint(pos.node)).first, this);
         }
 
         constexpr iterator insert(iterator pos, value_type&& value) noexcept
             requires(std::is_move_constructible_v<value_type> && !std::is_same_v<iterator, const_iterator>) {
             if (pos.bst_p != this) {
-                return iterator(this->_insert(value, this->root).first);
+                return iterator(this->_insert(std::move(value), this->root).first, this);
             }
 
-            return iterator(this->_insert(value, const_cast<_Node*>(pos.node)).first);
+            return iterator(this->_insert(std::move(value), this->_get_hint(pos.node)).first, this);
         }
 
         constexpr iterator insert(const_iterator pos, const_reference value) noexcept
             requires(std::is_copy_constructible_v<value_type>) {
             if (pos.bst_p != this) {
-                return iterator(this->_insert(value, this->root).first);
+                return iterator(this->_insert(value, this->root).first, this);
             }
 
-            return iterator(this->_insert(value, const_cast<_Node*>(pos.node)).first);
+            return iterator(this->_insert(value, this->_get_hint(pos.node)).first, this);
         }
 
         constexpr iterator insert(const_iterator pos, value_type&& value) noexcept
             requires(std::is_move_constructible_v<value_type>) {
             if (pos.bst_p != this) {
-                return iterator(this->_insert(value, this->root).first);
+                return iterator(this->_insert(std::move(value), this->root).first, this);
             }
 
-            return iterator(this->_insert(value, const_cast<_Node*>(pos.node)).first);
+            return iterator(this->_insert(std::move(value), this->_get_hint(pos.node)).first, this);
         }
 
         template<std::input_iterator InputIt>
@@ -2175,7 +3292,7 @@ namespace adt {
         }
 
         constexpr virtual void insert(std::initializer_list<value_type> values) noexcept override {
-            for (value_type value : values) {
+            for (const_reference value : values) {
                 this->_insert(value);
             }
         }
@@ -2196,7 +3313,7 @@ namespace adt {
                 node._destroy();
             }
 
-            return insert_return_type<iterator, node_type>(iterator(std::forward<_Node*>(pair.first)), pair.second, std::move(node));
+            return insert_return_type<iterator, node_type>(iterator(std::forward<_Node*>(pair.first), this), pair.second, std::move(node));
         }
 
         constexpr iterator insert(const_iterator pos, node_type&& node) noexcept {
@@ -2208,7 +3325,7 @@ namespace adt {
             }
 
             // Attempt to insert the node_handle's node into the BST at the current position
-            std::pair pair = this->_insert(node.node->value, const_cast<_Node*>(pos.node));
+            std::pair pair = this->_insert(node.node->value, this->_get_hint(pos.node));
 
             // If the node was successfully inserted...
             if (pair.second) {
@@ -2216,9 +3333,33 @@ namespace adt {
                 node._destroy();
             }
             
-            return iterator(pair.first);
+            return iterator(pair.first, this);
 	    }
 
+        constexpr iterator push_back_unchecked(const_reference value) noexcept
+            requires(std::is_copy_constructible_v<value_type>) {
+            // The caller guarantees that `value` is greater than every value in the BST
+            return iterator(this->_append(value), this);
+        }
+
+        template<std::input_iterator InputIt>
+        constexpr size_type append_sorted(InputIt first, InputIt last) noexcept {
+            size_type inserted = 0;
+
+            for (; first != last; ++first) {
+                // Values past the maximum node are appended directly; anything else (out of order or
+                // a duplicate) falls back to a regular insertion
+                if (this->max_node == nullptr || *first > this->max_node->value) {
+                    this->_append(*first);
+                    inserted++;
+                } else if (this->_insert(*first, this->max_node).second) {
+                    inserted++;
+                }
+            }
+
+            return inserted;
+        }
+
         template<class R>
         constexpr void insert_range(R&& range) noexcept
             requires(std::assignable_from<reference, std::ranges::range_reference_t<R>> && 
@@ -2229,24 +3370,19 @@ namespace adt {
         }
 
         template<class... Args>
-        constexpr std::pair<iterator, bool> emplace(Args... args) noexcept 
+        constexpr std::pair<iterator, bool> emplace(Args&&... args) noexcept
             requires(std::is_constructible_v<value_type, Args...>) {
-            std::pair<_Node*, bool> pair = this->_insert(value_type(std::forward<Args>(args)...));
-            return std::make_pair(iterator(pair.first), pair.second);
+            std::pair<_Node*, bool> pair = this->_emplace(nullptr, std::forward<Args>(args)...);
+            return std::make_pair(iterator(pair.first, this), pair.second);
         }
 
         template<class... Args>
-        constexpr iterator emplace_hint(const_iterator pos, Args... args) noexcept
+        constexpr iterator emplace_hint(const_iterator pos, Args&&... args) noexcept
             requires(std::is_constructible_v<value_type, Args...>) {
-            // If the iterator is not in a valid position within the BST...
-            if (pos.node == nullptr || pos.bst_p != this) {
-                // Emplace the arguments starting at the root node
-                return this->emplace(std::forward<value_type>(args)...).first;
-            }
-
-            // Otherwise, emplace the arguments at the iterator's position or as near as possible to it
-            _Node* pos_node = const_cast<_Node*>(pos.node);
-            return iterator(this->_insert(std::forward<value_type>(args)..., pos_node).first);
+            // Emplace the arguments at the iterator's position or as near as possible to it, or starting at the
+            // root if the iterator does not belong to this BST
+            _Node* hint = (pos.bst_p == this) ? this->_get_hint(pos.node) : nullptr;
+            return iterator(this->_emplace(hint, std::forward<Args>(args)...).first, this);
         }
 
         constexpr iterator erase(iterator pos) noexcept
@@ -2264,29 +3400,62 @@ namespace adt {
 
         iterator erase(iterator start, iterator end)
             requires(!std::is_same_v<iterator, const_iterator>) {
-            if (std::distance(start, end) <= 0 || this->sz == 1) {
+            return this->erase(const_iterator(start), const_iterator(end));
+        }
+
+        iterator erase(const_iterator start, const_iterator end) {
+            // Compare the endpoints' values instead of walking from `start` to `end`
+            if (start.node == end.node || start.node == nullptr ||
+                (end.node != nullptr && end.node->value < start.node->value)) {
                 throw std::invalid_argument("adt::binary_search_tree::erase() error: \"end\" must be reachable from \"start\"");
             }
 
-            iterator it = start;
-            while (it.node != end.node) {
-                it.node = this->_erase(it.node);
+            return iterator(this->_erase_range(const_cast<_Node*>(start.node), const_cast<_Node*>(end.node)), this);
+        }
+
+        [[nodiscard]] const_reference peek_min() const {
+            if (this->min_node == nullptr) {
+                throw std::out_of_range("adt::binary_search_tree::peek_min() error: the BST is empty");
             }
-            
-            return it;
+
+            return this->min_node->value;
         }
 
-        iterator erase(const_iterator start, const_iterator end) {
-            if (std::distance(start, end) <= 0 || this->sz == 1) {
-                throw std::invalid_argument("adt::binary_search_tree::erase() error: \"end\" must be reachable from \"start\"");
+        [[nodiscard]] const_reference peek_max() const {
+            if (this->max_node == nullptr) {
+                throw std::out_of_range("adt::binary_search_tree::peek_max() error: the BST is empty");
             }
 
-            _Node* it_node = const_cast<_Node*>(start.node);
-            while (it_node != end.node) {
-                it_node = this->_erase(it_node);
+            return this->max_node->value;
+        }
+
+        value_type pop_min() requires(std::is_move_constructible_v<value_type>) {
+            if (this->min_node == nullptr) {
+                throw std::out_of_range("adt::binary_search_tree::pop_min() error: the BST is empty");
             }
-            
-            return iterator(it_node);
+
+            _Node* target = this->_remove_min();
+            value_type value = std::move(target->value);
+            this->_destroy_node(target);
+
+            return value;
+        }
+
+        value_type pop_max() requires(std::is_move_constructible_v<value_type>) {
+            if (this->max_node == nullptr) {
+                throw std::out_of_range("adt::binary_search_tree::pop_max() error: the BST is empty");
+            }
+
+            _Node* target = this->_remove_max();
+            value_type value = std::move(target->value);
+            this->_destroy_node(target);
+
+            return value;
+        }
+
+        template<class Predicate>
+        constexpr size_type erase_if(Predicate pred) requires(std::predicate<Predicate&, const_reference>) {
+            return this->_erase_if(pred);
         }
 
         constexpr void swap(binary_search_tree& other) noexcept {
@@ -2298,6 +3467,10 @@ namespace adt {
                 return;
             }
 
+            // Each BST keeps its own cache, so neither may keep pointing at nodes it is giving away
+            this->_forget_all();
+            other._forget_all();
+
             _Node* temp_node;
             size_type temp_sz = this->sz;
             this->sz = other.sz;
@@ -2346,26 +3519,90 @@ namespace adt {
 
         constexpr iterator find(const_reference value) noexcept
             requires(std::is_copy_constructible_v<value_type>) {
-            iterator it = this->begin();
-            while (it != this->end() && it.node->value != value) {
-                it++;
-            }
-
-            return it;
+            return iterator(this->_lookup(value), this);
         }
 
         [[nodiscard]] constexpr const_iterator find(const_reference value) const noexcept
             requires(std::is_copy_constructible_v<value_type>) {
-            const_iterator cit = this->cbegin();
-            while (cit != this->cend() && cit.node->value != value) {
-                cit++;
+            return const_iterator(this->_lookup(value), this);
+        }
+
+        find_task async_find(value_type value) const requires(std::is_copy_constructible_v<value_type>) {
+            const _Node* curr = this->root;
+
+            // Descend towards `value`, yielding to the scheduler while each child is being fetched
+            while (curr != nullptr && !_equivalent(curr->value, value)) {
+                curr = (value < curr->value) ? curr->left : curr->right;
+                co_await typename find_task::prefetch_awaiter{curr};
             }
 
-            return cit;
+            co_return const_iterator(curr, this);
+        }
+
+        template<std::input_iterator InputIt, std::random_access_iterator OutputIt>
+        OutputIt interleaved_find(InputIt first, InputIt last, OutputIt out, size_type group_size = 8) const
+            requires(std::is_copy_constructible_v<value_type> && std::indirectly_writable<OutputIt, const_iterator>) {
+            if (group_size == 0) {
+                group_size = 1;
+            }
+
+            std::vector<find_task> tasks(group_size);
+            std::vector<difference_type> slots(group_size);
+            difference_type next = 0;
+            size_type in_flight = 0;
+
+            // Fill the group with the first `group_size` lookups
+            for (size_type i = 0; i < group_size && first != last; i++, ++first) {
+                tasks[i] = this->async_find(*first);
+                slots[i] = next++;
+                in_flight++;
+            }
+
+            // Round-robin the lookups so that each one's memory stall overlaps with the others' work
+            while (in_flight > 0) {
+                for (size_type i = 0; i < group_size; i++) {
+                    if (tasks[i].done() || tasks[i].resume()) {
+                        continue;
+                    }
+
+                    // The lookup has finished, so store its result and refill the slot
+                    out[slots[i]] = tasks[i].get();
+                    if (first != last) {
+                        tasks[i] = this->async_find(*first);
+                        slots[i] = next++;
+                        ++first;
+                    } else {
+                        tasks[i] = find_task();
+                        in_flight--;
+                    }
+                }
+            }
+
+            return out + next;
         }
 
         [[nodiscard]] constexpr virtual bool contains(const_reference value) const noexcept override {
-            return this->find(value) != this->end();
+            return this->_lookup(value) != nullptr;
+        }
+
+        // Put a direct-mapped cache of `slots` entries (rounded up to a power of two) in front of find() and
+        // contains(). Const lookups may still run concurrently with each other; enabling, disabling and every
+        // modification need exclusive access, as they do without the cache
+        void enable_hot_cache(size_type slots = 1024) requires(cacheable) {
+            unsigned int bits = static_cast<unsigned int>(std::bit_width(std::max<size_type>(slots, 2) - 1));
+            std::unique_ptr<_HotCache> cache = std::make_unique<_HotCache>();
+            cache->slots = std::vector<std::atomic<_Node*>>(size_type(1) << bits);
+            cache->shift = 64 - bits;
+
+            this->hot_cache = std::move(cache);
+        }
+
+        constexpr void disable_hot_cache() noexcept { this->hot_cache.reset(); }
+
+        [[nodiscard]] constexpr bst_cache_stats hot_cache_stats() const noexcept {
+            return (this->hot_cache == nullptr) ? bst_cache_stats{}
+                                                : bst_cache_stats{this->hot_cache->hits.load(std::memory_order_relaxed),
+                                                                  this->hot_cache->lookups.load(std::memory_order_relaxed)};
         }
 
         constexpr std::pair<iterator, iterator> equal_range(const_reference value) noexcept
@@ -2377,7 +3614,7 @@ namespace adt {
             }
 
             for (iterator it = this->begin(); it != this->end(); it++) {
-                if (it.node->value == value) {
+                if (_equivalent(it.node->value, value)) {
                     return std::make_pair(it, it + 1);
                 } else if (it.node->value > value) {
                     return std::make_pair(it, it);
@@ -2475,18 +3712,9 @@ namespace std {
 
     template<class T, class Allocator, class Predicate>
     constexpr typename adt::binary_search_tree<T, Allocator>::size_type erase_if(adt::binary_search_tree<T, Allocator>& bst, 
-                                                                                 Predicate pred) noexcept
+                                                                                 Predicate pred)
         requires(std::predicate<Predicate, T>) {
-        typename adt::binary_search_tree<T, Allocator>::size_type erase_count = 0;
-
-        for (auto it = bst.begin(); it != bst.end(); it++) {
-            if (pred(*it)) {
-                bst.erase(it);
-                erase_count++;
-            }
-        }
-
-        return erase_count;
+        return bst.erase_if(std::move(pred));
     }
 
 } // std
@@ -0,0 +1,1366 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+#include <numeric>
+#include <set>
+#include <queue>
+#include <functional>
+#include <limits>
+#include <unordered_set>
+#include <execution>
+#include <future>
+#include <thread>
+#include <mutex>
+#include <shared_mutex>
+#include <fstream>
+#include <filesystem>
+#include <cmath>
+
+#include "binary_search_tree.hpp"
+#include "persistent_search_tree.hpp"
+#include "concurrent_search_tree.hpp"
+#include "lock_free_search_tree.hpp"
+#include "sharded_search_tree.hpp"
+#include "rcu_search_tree.hpp"
+#include "buffered_search_tree.hpp"
+#include "frozen_search_tree.hpp"
+#include "compressed_search_tree.hpp"
+#include "string_search_tree.hpp"
+#include "splay_search_tree.hpp"
+
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <malloc.h>
+
+
+/* --------------------------------------------Definitions--------------------------------------------------- */
+using value_type = int;
+
+using size_type = std::size_t;
+
+using binary_search_tree = adt::binary_search_tree<value_type>;
+
+using clock_type = std::chrono::steady_clock;
+
+struct counted_key {
+	value_type key;
+
+	static inline size_type comparisons = 0;
+
+	friend bool operator==(const counted_key& lhs, const counted_key& rhs) noexcept {
+		comparisons++;
+		return lhs.key == rhs.key;
+	}
+
+	friend bool operator<(const counted_key& lhs, const counted_key& rhs) noexcept {
+		comparisons++;
+		return lhs.key < rhs.key;
+	}
+
+	friend bool operator>(const counted_key& lhs, const counted_key& rhs) noexcept {
+		comparisons++;
+		return lhs.key > rhs.key;
+	}
+};
+
+using counted_search_tree = adt::binary_search_tree<counted_key>;
+
+inline size_type allocated_bytes = 0;
+
+template<class T>
+struct counting_allocator {
+	using value_type = T;
+
+	counting_allocator() noexcept = default;
+
+	template<class U>
+	counting_allocator(const counting_allocator<U>&) noexcept {}
+
+	T* allocate(size_type n) {
+		allocated_bytes += n * sizeof(T);
+		return std::allocator<T>().allocate(n);
+	}
+
+	void deallocate(T* p, size_type n) noexcept {
+		allocated_bytes -= n * sizeof(T);
+		std::allocator<T>().deallocate(p, n);
+	}
+
+	friend bool operator==(const counting_allocator&, const counting_allocator&) noexcept { return true; }
+};
+
+using persistent_search_tree = adt::persistent_search_tree<value_type, counting_allocator<value_type>>;
+
+struct benchmark {
+	const char* name;
+
+	int (*run)(size_type n);
+};
+
+/* ---------------------------------------------Variables---------------------------------------------------- */
+constexpr size_type default_size = 1 << 20;
+
+constexpr unsigned int seed = 0x5eed;
+
+constexpr size_type max_append_size = 1 << 14;
+
+/* ---------------------------------------------Functions---------------------------------------------------- */
+std::vector<value_type> shuffled_keys(size_type n, unsigned int seed) {
+	std::vector<value_type> keys(n);
+	std::iota(keys.begin(), keys.end(), 0);
+	std::shuffle(keys.begin(), keys.end(), std::mt19937(seed));
+
+	return keys;
+}
+
+std::vector<value_type> zipf_queries(size_type n, size_type count, double skew, unsigned int seed) {
+	// Rank r is drawn with probability proportional to 1 / r^skew. Ranks map to keys through a shuffle, so the
+	// hot keys are scattered across the key space instead of sitting at one end of it
+	std::vector<double> cdf(n);
+	double sum = 0;
+	for (size_type i = 0; i < n; i++) {
+		sum += 1.0 / std::pow(static_cast<double>(i + 1), skew);
+		cdf[i] = sum;
+	}
+
+	std::vector<value_type> rank_keys = shuffled_keys(n, seed);
+	std::mt19937_64 rng(seed + 1);
+	std::uniform_real_distribution<double> uniform(0.0, sum);
+
+	std::vector<value_type> queries(count);
+	for (value_type& query : queries) {
+		size_type rank = std::lower_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin();
+		query = rank_keys[std::min(rank, n - 1)];
+	}
+
+	return queries;
+}
+
+template<class Function>
+double time_seconds(Function&& function) {
+	clock_type::time_point start = clock_type::now();
+	function();
+	return std::chrono::duration<double>(clock_type::now() - start).count();
+}
+
+void print_row(const std::string& label, size_type operations, double seconds) {
+	std::cout << std::left << std::setw(32) << label
+			  << std::right << std::setw(12) << std::fixed << std::setprecision(2)
+			  << (operations / seconds) / 1e6 << " Mops/s"
+			  << std::setw(12) << std::setprecision(1) << (seconds * 1e9) / operations << " ns/op\n";
+}
+
+void print_comparisons(const std::string& label, size_type operations, double seconds) {
+	std::cout << std::left << std::setw(32) << label
+			  << std::right << std::setw(12) << std::fixed << std::setprecision(2)
+			  << static_cast<double>(counted_key::comparisons) / operations << " cmp/op"
+			  << std::setw(12) << std::setprecision(1) << (seconds * 1e9) / operations << " ns/op\n";
+}
+
+int async_find(size_type n) {
+	std::vector<value_type> keys = shuffled_keys(n, seed);
+	std::vector<value_type> queries = shuffled_keys(n, seed + 1);
+	std::vector<binary_search_tree::const_iterator> results(queries.size());
+	binary_search_tree bst;
+
+	for (value_type key : keys) {
+		bst.insert(key);
+	}
+
+	std::cout << "async_find: " << n << " keys, " << queries.size() << " lookups\n";
+	for (size_type group_size = 1; group_size <= 64; group_size *= 2) {
+		double seconds = time_seconds([&] {
+			bst.interleaved_find(queries.begin(), queries.end(), results.begin(), group_size);
+		});
+
+		print_row("group_size = " + std::to_string(group_size), queries.size(), seconds);
+	}
+
+	return 0;
+}
+
+int finger_insert(size_type n) {
+	size_type append_size = std::min(n, max_append_size);
+
+	std::cout << "finger_insert: " << append_size << " sorted appends, " << n << " keys for hinted inserts\n";
+
+	// Sorted appends without a hint descend from the root every time
+	{
+		counted_search_tree bst;
+		counted_key::comparisons = 0;
+		double seconds = time_seconds([&] {
+			for (value_type key = 0; key < static_cast<value_type>(append_size); key++) {
+				bst.insert(counted_key{key});
+			}
+		});
+		print_comparisons("append, no hint", append_size, seconds);
+	}
+
+	// Sorted appends hinted with end() attach directly to the maximum node
+	{
+		counted_search_tree bst;
+		counted_key::comparisons = 0;
+		double seconds = time_seconds([&] {
+			for (value_type key = 0; key < static_cast<value_type>(append_size); key++) {
+				bst.insert(bst.cend(), counted_key{key});
+			}
+		});
+		print_comparisons("append, hint = end()", append_size, seconds);
+	}
+
+	// Sorted appends hinted with the previously inserted key
+	{
+		counted_search_tree bst;
+		counted_search_tree::const_iterator hint = bst.cend();
+		counted_key::comparisons = 0;
+		double seconds = time_seconds([&] {
+			for (value_type key = 0; key < static_cast<value_type>(append_size); key++) {
+				hint = bst.insert(hint, counted_key{key});
+			}
+		});
+		print_comparisons("append, hint = previous", append_size, seconds);
+	}
+
+	// Inserts at an in-order distance `d` from the hint in a randomly built BST of even keys
+	std::vector<value_type> order = shuffled_keys(n, seed);
+	std::vector<value_type> positions = shuffled_keys(n, seed + 1);
+	for (size_type d = 1; d <= 4096 && d < n; d *= 16) {
+		counted_search_tree bst;
+		std::vector<counted_search_tree::const_iterator> hints(n);
+		for (value_type i : order) {
+			hints[i] = bst.insert(counted_key{2 * i}).first;
+		}
+
+		size_type inserts = 0;
+		counted_key::comparisons = 0;
+		double seconds = time_seconds([&] {
+			for (value_type i : positions) {
+				if (static_cast<size_type>(i) + d < n) {
+					bst.insert(hints[i], counted_key{2 * (i + static_cast<value_type>(d)) - 1});
+					inserts++;
+				}
+			}
+		});
+		print_comparisons("distance = " + std::to_string(d) + ", hinted", inserts, seconds);
+
+		counted_search_tree unhinted;
+		for (value_type i : order) {
+			unhinted.insert(counted_key{2 * i});
+		}
+
+		counted_key::comparisons = 0;
+		seconds = time_seconds([&] {
+			for (value_type i : positions) {
+				if (static_cast<size_type>(i) + d < n) {
+					unhinted.insert(counted_key{2 * (i + static_cast<value_type>(d)) - 1});
+				}
+			}
+		});
+		print_comparisons("distance = " + std::to_string(d) + ", no hint", inserts, seconds);
+	}
+
+	return 0;
+}
+
+int sorted_append(size_type n) {
+	std::vector<value_type> keys(n);
+	std::iota(keys.begin(), keys.end(), 0);
+
+	std::cout << "sorted_append: " << n << " monotonic keys\n";
+
+	{
+		binary_search_tree bst;
+		double seconds = time_seconds([&] {
+			for (value_type key : keys) {
+				bst.insert(key);
+			}
+		});
+		print_row("insert (max_node fast path)", n, seconds);
+	}
+
+	{
+		binary_search_tree bst;
+		double seconds = time_seconds([&] { bst.append_sorted(keys.begin(), keys.end()); });
+		print_row("append_sorted", n, seconds);
+	}
+
+	{
+		binary_search_tree bst;
+		double seconds = time_seconds([&] {
+			for (value_type key : keys) {
+				bst.push_back_unchecked(key);
+			}
+		});
+		print_row("push_back_unchecked", n, seconds);
+	}
+
+	{
+		std::set<value_type> set;
+		double seconds = time_seconds([&] {
+			for (value_type key : keys) {
+				set.emplace_hint(set.end(), key);
+			}
+		});
+		print_row("std::set::emplace_hint(end())", n, seconds);
+	}
+
+	return 0;
+}
+
+int priority_queue(size_type n) {
+	std::vector<value_type> keys = shuffled_keys(n, seed);
+	std::vector<value_type> deletions = shuffled_keys(n / 2, seed + 1);
+
+	// Every third pop is paired with an arbitrary delete from the upper half of the keys, which are
+	// never reached by the pops before they are deleted
+	std::transform(deletions.begin(), deletions.end(), deletions.begin(), [n](value_type key) {
+		return key + static_cast<value_type>(n / 2);
+	});
+	deletions.resize(n / 6);
+
+	size_type pops = n - deletions.size();
+	long long checksum = 0;
+
+	std::cout << "priority_queue: " << n << " keys, " << pops << " pops, " << deletions.size() << " deletes\n";
+
+	{
+		binary_search_tree bst;
+		std::vector<binary_search_tree::const_iterator> handles(n);
+		for (value_type key : keys) {
+			handles[key] = bst.insert(key).first;
+		}
+
+		double seconds = time_seconds([&] {
+			for (size_type i = 0, d = 0; i < pops; i++) {
+				checksum += bst.peek_min();
+				checksum += bst.pop_min();
+				if (i % 3 == 0 && d < deletions.size()) {
+					bst.erase(handles[deletions[d++]]);
+				}
+			}
+		});
+		print_row("binary_search_tree::pop_min", pops, seconds);
+	}
+
+	{
+		std::priority_queue<value_type, std::vector<value_type>, std::greater<value_type>> queue(
+			std::greater<value_type>(), std::vector<value_type>(keys.begin(), keys.end())
+		);
+		std::unordered_set<value_type> deleted;
+
+		double seconds = time_seconds([&] {
+			for (size_type i = 0, d = 0; i < pops; i++) {
+				// Lazily drop entries that were deleted while they were still in the heap
+				while (deleted.erase(queue.top()) > 0) {
+					queue.pop();
+				}
+				checksum += queue.top();
+				checksum += queue.top();
+				queue.pop();
+				if (i % 3 == 0 && d < deletions.size()) {
+					deleted.insert(deletions[d++]);
+				}
+			}
+		});
+		print_row("std::priority_queue (lazy)", pops, seconds);
+	}
+
+	{
+		std::set<value_type> set(keys.begin(), keys.end());
+
+		double seconds = time_seconds([&] {
+			for (size_type i = 0, d = 0; i < pops; i++) {
+				checksum += *set.begin();
+				checksum += *set.begin();
+				set.erase(set.begin());
+				if (i % 3 == 0 && d < deletions.size()) {
+					set.erase(deletions[d++]);
+				}
+			}
+		});
+		print_row("std::set::erase(begin())", pops, seconds);
+	}
+
+	std::cout << "checksum: " << checksum << '\n';
+
+	return 0;
+}
+
+int range_erase(size_type n) {
+	std::vector<value_type> keys = shuffled_keys(n, seed);
+
+	std::cout << "range_erase: " << n << " keys, windows expired from the front\n";
+	for (size_type window = 64; window <= n / 4; window *= 16) {
+		// Split-and-discard range erase
+		{
+			binary_search_tree bst;
+			std::vector<binary_search_tree::const_iterator> handles(n);
+			for (value_type key : keys) {
+				handles[key] = bst.insert(key).first;
+			}
+
+			double seconds = time_seconds([&] {
+				for (size_type start = 0; start + window < n; start += window) {
+					bst.erase(handles[start], handles[start + window]);
+				}
+			});
+			print_row("erase(first, last), w = " + std::to_string(window), n - n % window, seconds);
+		}
+
+		// One erase per element
+		{
+			binary_search_tree bst;
+			std::vector<binary_search_tree::const_iterator> handles(n);
+			for (value_type key : keys) {
+				handles[key] = bst.insert(key).first;
+			}
+
+			double seconds = time_seconds([&] {
+				for (size_type start = 0; start + window < n; start += window) {
+					for (size_type i = start; i < start + window; i++) {
+						bst.erase(handles[i]);
+					}
+				}
+			});
+			print_row("erase(pos) x w, w = " + std::to_string(window), n - n % window, seconds);
+		}
+
+		{
+			std::set<value_type> set(keys.begin(), keys.end());
+
+			double seconds = time_seconds([&] {
+				for (size_type start = 0; start + window < n; start += window) {
+					set.erase(set.find(static_cast<value_type>(start)), set.find(static_cast<value_type>(start + window)));
+				}
+			});
+			print_row("std::set::erase, w = " + std::to_string(window), n - n % window, seconds);
+		}
+	}
+
+	return 0;
+}
+
+int erase_if(size_type n) {
+	std::vector<value_type> keys = shuffled_keys(n, seed);
+	auto is_odd = [](value_type key) { return key % 2 != 0; };
+
+	std::cout << "erase_if: " << n << " keys, 50% deleted\n";
+
+	{
+		binary_search_tree bst;
+		for (value_type key : keys) {
+			bst.insert(key);
+		}
+
+		size_type erased = 0;
+		double seconds = time_seconds([&] { erased = std::erase_if(bst, is_odd); });
+		print_row("std::erase_if(binary_search_tree)", n, seconds);
+		std::cout << "erased: " << erased << '\n';
+	}
+
+	{
+		std::set<value_type> set(keys.begin(), keys.end());
+
+		double seconds = time_seconds([&] { std::erase_if(set, is_odd); });
+		print_row("std::erase_if(std::set)", n, seconds);
+	}
+
+	return 0;
+}
+
+int copy(size_type n) {
+	std::vector<value_type> keys = shuffled_keys(n, seed);
+	binary_search_tree random_bst;
+	for (value_type key : keys) {
+		random_bst.insert(key);
+	}
+
+	// Sorted input degenerates into a chain, the worst case for a recursive copy
+	binary_search_tree chain_bst;
+	for (value_type key = 0; key < static_cast<value_type>(n); key++) {
+		chain_bst.push_back_unchecked(key);
+	}
+
+	std::cout << "copy: " << n << " keys\n";
+
+	{
+		double seconds = time_seconds([&] { binary_search_tree dst(random_bst); });
+		print_row("copy, random shape", n, seconds);
+	}
+
+	{
+		double seconds = time_seconds([&] { binary_search_tree dst(chain_bst); });
+		print_row("copy, chain shape", n, seconds);
+	}
+
+	{
+		double seconds = time_seconds([&] { binary_search_tree dst(chain_bst, adt::bst_shapes::balanced); });
+		print_row("copy, chain to balanced", n, seconds);
+	}
+
+	{
+		std::set<value_type> set(keys.begin(), keys.end());
+
+		double seconds = time_seconds([&] { std::set<value_type> dst(set); });
+		print_row("std::set copy", n, seconds);
+	}
+
+	return 0;
+}
+
+int parallel_build(size_type n) {
+	std::vector<value_type> keys(n);
+	std::iota(keys.begin(), keys.end(), 0);
+
+	binary_search_tree src;
+	for (value_type key : shuffled_keys(n, seed)) {
+		src.insert(key);
+	}
+
+	std::cout << "parallel_build: " << n << " keys, " << std::thread::hardware_concurrency() 
+			  << " hardware threads\n";
+	for (size_type threads = 1; threads <= 32; threads *= 2) {
+		double seconds = time_seconds([&] {
+			binary_search_tree bst(std::execution::par, adt::bst_sorted_unique, keys.begin(), keys.end(), threads);
+		});
+		print_row("sorted build, threads = " + std::to_string(threads), n, seconds);
+	}
+
+	for (size_type threads = 1; threads <= 32; threads *= 2) {
+		double seconds = time_seconds([&] { binary_search_tree bst(std::execution::par, src, threads); });
+		print_row("copy, threads = " + std::to_string(threads), n, seconds);
+	}
+
+	return 0;
+}
+
+int teardown(size_type n) {
+	std::vector<value_type> keys = shuffled_keys(n, seed);
+	auto build = [&] {
+		binary_search_tree bst;
+		for (value_type key : keys) {
+			bst.insert(key);
+		}
+		return bst;
+	};
+
+	std::cout << "teardown: " << n << " keys\n";
+
+	{
+		binary_search_tree bst = build();
+		double seconds = time_seconds([&] { bst.clear(); });
+		print_row("clear()", n, seconds);
+	}
+
+	for (size_type threads = 2; threads <= 8; threads *= 2) {
+		binary_search_tree bst = build();
+		double seconds = time_seconds([&] { bst.clear(std::execution::par, threads); });
+		print_row("clear(par), threads = " + std::to_string(threads), n, seconds);
+	}
+
+	{
+		binary_search_tree bst = build();
+		std::future<size_type> reclaimed;
+
+		// Only the time until clear_async() returns is spent on the calling thread
+		double seconds = time_seconds([&] { reclaimed = bst.clear_async(); });
+		print_row("clear_async(), return", n, seconds);
+
+		seconds += time_seconds([&] { reclaimed.wait(); });
+		print_row("clear_async(), reclaimed", n, seconds);
+	}
+
+	return 0;
+}
+
+int persistent(size_type n) {
+	constexpr size_type versions = 1000;
+	std::vector<value_type> keys = shuffled_keys(n, seed);
+	std::vector<value_type> updates = shuffled_keys(versions, seed + 1);
+
+	std::cout << "persistent: " << n << " keys, " << versions << " versions\n";
+
+	{
+		binary_search_tree bst;
+		for (value_type key : keys) {
+			bst.insert(key);
+		}
+
+		// Every snapshot of a mutable BST is a full deep copy
+		std::vector<binary_search_tree> snapshots;
+		snapshots.reserve(10);
+		double seconds = time_seconds([&] {
+			for (size_type i = 0; i < 10; i++) {
+				snapshots.emplace_back(bst);
+			}
+		});
+		print_row("binary_search_tree snapshot", 10, seconds);
+	}
+
+	{
+		persistent_search_tree pst(keys.begin(), keys.end());
+
+		std::vector<persistent_search_tree> snapshots;
+		snapshots.reserve(versions);
+		double seconds = time_seconds([&] {
+			for (size_type i = 0; i < versions; i++) {
+				snapshots.push_back(pst.snapshot());
+			}
+		});
+		print_row("persistent_search_tree snapshot", versions, seconds);
+	}
+
+	{
+		persistent_search_tree pst(keys.begin(), keys.end());
+		std::vector<persistent_search_tree> history = {pst};
+		size_type base_bytes = allocated_bytes;
+
+		// Keep every version alive; each one only owns the nodes on its copied path
+		double seconds = time_seconds([&] {
+			for (value_type update : updates) {
+				history.push_back(history.back().insert(static_cast<value_type>(n) + update));
+			}
+		});
+		print_row("persistent_search_tree insert", versions, seconds);
+
+		std::cout << "bytes per version: " << (allocated_bytes - base_bytes) / versions
+				  << " (full copy: " << base_bytes << ")\n";
+	}
+
+	return 0;
+}
+
+template<class Tree, class Read, class Write>
+double mixed_workload(Tree& tree, const std::vector<value_type>& keys, size_type threads, size_type operations, 
+					  Read read, Write write, size_type write_every = 20) {
+	std::vector<std::thread> workers;
+
+	return time_seconds([&] {
+		for (size_type t = 0; t < threads; t++) {
+			workers.emplace_back([&, t] {
+				std::mt19937 rng(seed + t);
+				size_type found = 0;
+
+				// One operation in `write_every` is a write; the rest are lookups
+				for (size_type i = 0; i < operations; i++) {
+					value_type key = keys[rng() % keys.size()];
+					if (i % write_every == 0) {
+						write(tree, key);
+					} else {
+						found += read(tree, key);
+					}
+				}
+
+				if (found == std::numeric_limits<size_type>::max()) {
+					std::cout << found;
+				}
+			});
+		}
+
+		for (std::thread& worker : workers) {
+			worker.join();
+		}
+	});
+}
+
+double mutex_workload(const std::vector<value_type>& keys, size_type threads, size_type operations, 
+					  size_type write_every) {
+	binary_search_tree bst;
+	for (value_type key : keys) {
+		bst.insert(key);
+	}
+	std::mutex mutex;
+
+	// find() and contains() scan in order, so the locked BST looks keys up by descending from the root instead
+	auto descend = [](const binary_search_tree& tree, value_type key) {
+		binary_search_tree::const_iterator cit;
+		tree.interleaved_find(&key, &key + 1, &cit, 1);
+		return cit;
+	};
+
+	return mixed_workload(bst, keys, threads, operations, 
+		[&](auto& tree, value_type key) {
+			std::lock_guard<std::mutex> lock(mutex);
+			return descend(tree, key) != tree.cend();
+		},
+		[&](auto& tree, value_type key) {
+			std::lock_guard<std::mutex> lock(mutex);
+			if (binary_search_tree::const_iterator cit = descend(tree, key); cit != tree.cend()) {
+				tree.erase(cit);
+			} else {
+				tree.insert(key);
+			}
+		}, write_every);
+}
+
+int concurrent(size_type n) {
+	constexpr size_type operations = 1 << 18;
+	std::vector<value_type> keys = shuffled_keys(n, seed);
+
+	std::cout << "concurrent: " << n << " keys, 95% lookups, " << operations << " operations per thread, " 
+			  << std::thread::hardware_concurrency() << " hardware threads\n";
+
+	for (size_type threads = 1; threads <= 32; threads *= 2) {
+		adt::concurrent_search_tree<value_type> cst;
+		for (value_type key : keys) {
+			cst.insert(key);
+		}
+
+		// Writers flip a key out of the BST and back in, so the key set stays the same on average
+		double seconds = mixed_workload(cst, keys, threads, operations, 
+			[](auto& tree, value_type key) { return tree.contains(key); },
+			[](auto& tree, value_type key) {
+				if (tree.erase(key) == 0) {
+					tree.insert(key);
+				}
+			});
+		print_row("seqlock, threads = " + std::to_string(threads), threads * operations, seconds);
+	}
+
+	for (size_type threads = 1; threads <= 32; threads *= 2) {
+		double seconds = mutex_workload(keys, threads, operations, 20);
+		print_row("mutex, threads = " + std::to_string(threads), threads * operations, seconds);
+	}
+
+	return 0;
+}
+
+int lock_free(size_type n) {
+	constexpr size_type operations = 1 << 18;
+	std::vector<value_type> keys = shuffled_keys(n, seed);
+
+	std::cout << "lock_free: " << n << " keys, " << operations << " operations per thread, " 
+			  << std::thread::hardware_concurrency() << " hardware threads\n";
+
+	// A read-mostly mix, then one where every other operation is a write
+	for (size_type write_every : {20, 2}) {
+		std::cout << "one write in " << write_every << " operations\n";
+
+		for (size_type threads = 1; threads <= 32; threads *= 2) {
+			adt::lock_free_search_tree<value_type> lfst;
+			for (value_type key : keys) {
+				lfst.insert(key);
+			}
+
+			double seconds = mixed_workload(lfst, keys, threads, operations, 
+				[](auto& tree, value_type key) { return tree.contains(key); },
+				[](auto& tree, value_type key) {
+					if (tree.erase(key) == 0) {
+						tree.insert(key);
+					}
+				}, write_every);
+			print_row("lock-free, threads = " + std::to_string(threads), threads * operations, seconds);
+		}
+
+		for (size_type threads = 1; threads <= 32; threads *= 2) {
+			double seconds = mutex_workload(keys, threads, operations, write_every);
+			print_row("mutex, threads = " + std::to_string(threads), threads * operations, seconds);
+		}
+	}
+
+	return 0;
+}
+
+int sharded(size_type n) {
+	constexpr size_type operations = 1 << 18;
+	constexpr size_type write_every = 2;
+	std::vector<value_type> keys = shuffled_keys(n, seed);
+
+	std::cout << "sharded: " << n << " keys, one write in " << write_every << " operations, " << operations 
+			  << " operations per thread, " << std::thread::hardware_concurrency() << " hardware threads\n";
+
+	for (size_type threads = 1; threads <= 32; threads *= 2) {
+		adt::sharded_search_tree<value_type, 16> sst(keys.begin(), keys.end());
+
+		double seconds = mixed_workload(sst, keys, threads, operations, 
+			[](auto& tree, value_type key) { return tree.contains(key); },
+			[](auto& tree, value_type key) {
+				if (tree.erase(key) == 0) {
+					tree.insert(key);
+				}
+			}, write_every);
+		print_row("16 shards, threads = " + std::to_string(threads), threads * operations, seconds);
+	}
+
+	for (size_type threads = 1; threads <= 32; threads *= 2) {
+		double seconds = mutex_workload(keys, threads, operations, write_every);
+		print_row("mutex, threads = " + std::to_string(threads), threads * operations, seconds);
+	}
+
+	return 0;
+}
+
+int rcu(size_type n) {
+	constexpr size_type lookups = 1 << 20;
+	std::vector<value_type> keys = shuffled_keys(n, seed);
+	std::vector<value_type> queries = shuffled_keys(n, seed + 1);
+
+	std::cout << "rcu: " << n << " keys, " << lookups << " lookups per thread\n";
+
+	binary_search_tree bst(keys.begin(), keys.end());
+	adt::rcu_search_tree<value_type> rcu{binary_search_tree(bst)};
+	std::shared_mutex mutex;
+
+	auto descend = [](const binary_search_tree& tree, value_type key) {
+		binary_search_tree::const_iterator cit;
+		tree.interleaved_find(&key, &key + 1, &cit, 1);
+		return cit != tree.cend();
+	};
+
+	// Read-side cost on one thread: each variant wraps the same descent
+	auto single = [&](const std::string& label, auto&& lookup) {
+		size_type found = 0;
+		double seconds = time_seconds([&] {
+			for (size_type i = 0; i < lookups; i++) {
+				found += lookup(queries[i % queries.size()]);
+			}
+		});
+
+		print_row(label, lookups, seconds);
+		return found;
+	};
+
+	adt::rcu_search_tree<value_type>::reader reader = rcu.register_reader();
+	single("unsynchronized", [&](value_type key) { return descend(bst, key); });
+	single("rcu reader", [&](value_type key) { return descend(reader.load(), key); });
+	single("shared_mutex", [&](value_type key) {
+		std::shared_lock<std::shared_mutex> lock(mutex);
+		return descend(bst, key);
+	});
+	reader.offline();
+
+	// Readers running alongside a writer that publishes a new version every 10 milliseconds
+	for (size_type threads = 1; threads <= 8; threads *= 2) {
+		for (bool use_rcu : {true, false}) {
+			std::atomic<bool> done = false;
+			std::thread writer([&] {
+				for (value_type value = 0; !done.load(); value++) {
+					if (use_rcu) {
+						rcu.update([value](binary_search_tree& next) { next.insert(-value - 1); });
+					} else {
+						std::unique_lock<std::shared_mutex> lock(mutex);
+						bst.insert(-value - 1);
+					}
+					std::this_thread::sleep_for(std::chrono::milliseconds(10));
+				}
+			});
+
+			std::vector<std::thread> readers;
+			double seconds = time_seconds([&] {
+				for (size_type t = 0; t < threads; t++) {
+					readers.emplace_back([&, t] {
+						adt::rcu_search_tree<value_type>::reader reader = rcu.register_reader();
+						size_type found = 0;
+
+						for (size_type i = 0; i < lookups; i++) {
+							value_type key = queries[(i + t * 7919) % queries.size()];
+							if (use_rcu) {
+								found += descend(reader.load(), key);
+								if (i % 256 == 0) {
+									reader.quiescent();
+								}
+							} else {
+								std::shared_lock<std::shared_mutex> lock(mutex);
+								found += descend(bst, key);
+							}
+						}
+
+						if (found == std::numeric_limits<size_type>::max()) {
+							std::cout << found;
+						}
+					});
+				}
+
+				for (std::thread& thread : readers) {
+					thread.join();
+				}
+			});
+
+			done = true;
+			writer.join();
+
+			std::string label = use_rcu ? "rcu, readers = " : "shared_mutex, readers = ";
+			print_row(label + std::to_string(threads), threads * lookups, seconds);
+		}
+	}
+
+	return 0;
+}
+
+int buffered(size_type n) {
+	std::vector<value_type> keys = shuffled_keys(n, seed);
+	std::vector<value_type> queries = shuffled_keys(n, seed + 1);
+
+	std::cout << "buffered: " << n << " random inserts, then " << n << " lookups\n";
+
+	{
+		binary_search_tree bst;
+
+		double seconds = time_seconds([&] {
+			for (value_type key : keys) {
+				bst.insert(key);
+			}
+		});
+		print_row("binary_search_tree insert", n, seconds);
+
+		size_type found = 0;
+		seconds = time_seconds([&] {
+			for (value_type key : queries) {
+				binary_search_tree::const_iterator cit;
+				bst.interleaved_find(&key, &key + 1, &cit, 1);
+				found += (cit != bst.cend());
+			}
+		});
+		print_row("binary_search_tree lookup", n, seconds);
+
+		if (found == std::numeric_limits<size_type>::max()) {
+			std::cout << found;
+		}
+	}
+
+	for (size_type capacity : {256, 1024, 4096, 16384}) {
+		adt::buffered_search_tree<value_type> bst(capacity);
+
+		// Sustained ingest includes every merge the inserts trigger, plus the final one
+		double seconds = time_seconds([&] {
+			for (value_type key : keys) {
+				bst.insert(key);
+			}
+			bst.flush();
+		});
+		print_row("buffer " + std::to_string(capacity) + " insert", n, seconds);
+
+		// Lookups with a half-full buffer pay for the buffer search before the descent
+		for (size_type i = 0; i < capacity / 2; i++) {
+			bst.erase(keys[i]);
+		}
+
+		size_type found = 0;
+		seconds = time_seconds([&] {
+			for (value_type key : queries) {
+				found += bst.contains(key);
+			}
+		});
+		print_row("buffer " + std::to_string(capacity) + " lookup", n, seconds);
+
+		if (found == std::numeric_limits<size_type>::max()) {
+			std::cout << found;
+		}
+	}
+
+	return 0;
+}
+
+int snapshot(size_type n) {
+	std::vector<value_type> keys(n);
+	std::iota(keys.begin(), keys.end(), 0);
+	std::filesystem::path path = std::filesystem::temp_directory_path() / "binary_search_tree_snapshot.bin";
+
+	std::cout << "snapshot: " << n << " keys through " << path << '\n';
+
+	{
+		binary_search_tree bst(adt::bst_sorted_unique, keys.begin(), keys.end());
+
+		double seconds = time_seconds([&] {
+			std::ofstream out(path, std::ios::binary | std::ios::trunc);
+			bst.save(out);
+		});
+		print_row("save", n, seconds);
+	}
+
+	// Only one tree is alive at a time, so the largest sizes fit in memory
+	{
+		binary_search_tree bst;
+
+		double seconds = time_seconds([&] {
+			std::ifstream in(path, std::ios::binary);
+			bst.load(in);
+		});
+		print_row("load", n, seconds);
+
+		if (bst.size() != n) {
+			std::cout << "Loaded " << bst.size() << " of " << n << " keys\n";
+			return 1;
+		}
+	}
+
+	// The alternative to a snapshot: replay the keys one insert at a time
+	{
+		std::vector<value_type> shuffled = shuffled_keys(n, seed);
+		binary_search_tree bst;
+
+		double seconds = time_seconds([&] {
+			for (value_type key : shuffled) {
+				bst.insert(key);
+			}
+		});
+		print_row("re-insert", n, seconds);
+	}
+
+	std::filesystem::remove(path);
+
+	return 0;
+}
+
+int frozen(size_type n) {
+	std::vector<value_type> keys(n);
+	std::iota(keys.begin(), keys.end(), 0);
+	std::filesystem::path snapshot_path = std::filesystem::temp_directory_path() / "binary_search_tree_snapshot.bin";
+	std::filesystem::path frozen_path = std::filesystem::temp_directory_path() / "binary_search_tree_frozen.bin";
+
+	{
+		binary_search_tree bst(adt::bst_sorted_unique, keys.begin(), keys.end());
+		std::ofstream out(snapshot_path, std::ios::binary | std::ios::trunc);
+		bst.save(out);
+		adt::frozen_search_tree<value_type>::freeze(bst, frozen_path);
+	}
+
+	std::cout << "frozen: " << n << " keys, " << std::filesystem::file_size(frozen_path) << " byte file\n";
+
+	// Getting to the first query: a full reload against a mapping that reads nothing up front
+	{
+		binary_search_tree bst;
+		double seconds = time_seconds([&] {
+			std::ifstream in(snapshot_path, std::ios::binary);
+			bst.load(in);
+		});
+		print_row("snapshot load, whole file", 1, seconds);
+
+		seconds = time_seconds([&] { adt::frozen_search_tree<value_type> fst(frozen_path); });
+		print_row("frozen open, whole file", 1, seconds);
+	}
+
+	std::vector<value_type> queries = shuffled_keys(n, seed + 1);
+	queries.resize(std::min<size_type>(n, 1 << 16));
+
+	// Drop the file from the page cache so the first pass has to fault every page it touches in from disk
+	int fd = ::open(frozen_path.c_str(), O_RDONLY);
+	::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+	::close(fd);
+
+	adt::frozen_search_tree<value_type> fst(frozen_path);
+	for (const char* label : {"frozen cold lookup", "frozen warm lookup"}) {
+		rusage before, after;
+		size_type found = 0;
+
+		::getrusage(RUSAGE_SELF, &before);
+		double seconds = time_seconds([&] {
+			for (value_type key : queries) {
+				found += fst.contains(key);
+			}
+		});
+		::getrusage(RUSAGE_SELF, &after);
+
+		print_row(label, queries.size(), seconds);
+		std::cout << "    " << (after.ru_majflt - before.ru_majflt) << " major, "
+				  << (after.ru_minflt - before.ru_minflt) << " minor page faults\n";
+
+		if (found != queries.size()) {
+			std::cout << "Found " << found << " of " << queries.size() << " keys\n";
+			return 1;
+		}
+	}
+
+	std::filesystem::remove(snapshot_path);
+	std::filesystem::remove(frozen_path);
+
+	return 0;
+}
+
+int compressed(size_type n) {
+	std::mt19937 rng(seed);
+
+	// Dense keys, and sparse keys whose gaps average about 100
+	std::vector<value_type> dense(n);
+	std::iota(dense.begin(), dense.end(), 0);
+	std::vector<value_type> sparse(n);
+	for (size_type i = 0, key = 0; i < n; i++) {
+		key += 1 + rng() % 200;
+		sparse[i] = static_cast<value_type>(key);
+	}
+
+	std::cout << "compressed: " << n << " keys, then " << n << " lookups\n";
+	for (auto [name, keys] : {std::pair{"dense", &dense}, std::pair{"sparse", &sparse}}) {
+		std::vector<value_type> queries(n);
+		for (value_type& query : queries) {
+			query = (*keys)[rng() % n];
+		}
+
+		{
+			// The heap in use before and after the build gives the real cost of each node, allocator overhead included
+			size_type before = mallinfo2().uordblks;
+			binary_search_tree bst(adt::bst_sorted_unique, keys->begin(), keys->end());
+			size_type bytes = mallinfo2().uordblks - before;
+
+			size_type found = 0;
+			double seconds = time_seconds([&] {
+				for (value_type key : queries) {
+					binary_search_tree::const_iterator cit;
+					bst.interleaved_find(&key, &key + 1, &cit, 1);
+					found += (cit != bst.cend());
+				}
+			});
+			print_row(std::string(name) + " binary_search_tree lookup", n, seconds);
+			std::cout << "    " << std::setprecision(2) << static_cast<double>(bytes) / n << " bytes/key\n";
+
+			if (found == std::numeric_limits<size_type>::max()) {
+				std::cout << found;
+			}
+		}
+
+		{
+			adt::compressed_search_tree<value_type> cst(adt::bst_sorted_unique, keys->begin(), keys->end());
+
+			size_type found = 0;
+			double seconds = time_seconds([&] {
+				for (value_type key : queries) {
+					found += cst.contains(key);
+				}
+			});
+			print_row(std::string(name) + " compressed lookup", n, seconds);
+			std::cout << "    " << std::setprecision(2) << static_cast<double>(cst.memory_usage()) / n
+					  << " bytes/key\n";
+
+			long long sum = 0;
+			seconds = time_seconds([&] {
+				for (value_type key : cst) {
+					sum += key;
+				}
+			});
+			print_row(std::string(name) + " compressed iteration", n, seconds);
+
+			if (found == std::numeric_limits<size_type>::max() || sum == 1) {
+				std::cout << found << sum;
+			}
+		}
+	}
+
+	return 0;
+}
+
+template<size_type BlockSize>
+void front_coded_lookups(const std::vector<std::string>& keys, const std::vector<std::string>& queries) {
+	adt::string_search_tree<BlockSize> sst(adt::bst_sorted_unique, keys.begin(), keys.end());
+
+	size_type found = 0;
+	double seconds = time_seconds([&] {
+		for (const std::string& key : queries) {
+			found += sst.contains(key);
+		}
+	});
+	print_row("front coded " + std::to_string(BlockSize) + " lookup", queries.size(), seconds);
+	std::cout << "    " << std::setprecision(2) << static_cast<double>(sst.memory_usage()) / keys.size()
+			  << " bytes/key\n";
+
+	if (found == std::numeric_limits<size_type>::max()) {
+		std::cout << found;
+	}
+}
+
+int strings(size_type n) {
+	// URL-like keys, which share long prefixes with their neighbors
+	std::vector<std::string> keys(n);
+	for (size_type i = 0; i < n; i++) {
+		keys[i] = "https://example.com/users/" + std::to_string(i / 16) + "/posts/" + std::to_string(i % 16);
+	}
+	std::sort(keys.begin(), keys.end());
+
+	std::vector<std::string> queries(n);
+	std::mt19937 rng(seed);
+	for (std::string& query : queries) {
+		query = keys[rng() % n];
+	}
+
+	size_type length = 0;
+	for (const std::string& key : keys) {
+		length += key.size();
+	}
+
+	std::cout << "strings: " << n << " URL keys averaging " << std::fixed << std::setprecision(1)
+			  << static_cast<double>(length) / n << " characters, then " << n << " lookups\n";
+
+	{
+		size_type before = mallinfo2().uordblks;
+		adt::binary_search_tree<std::string> bst(adt::bst_sorted_unique, keys.begin(), keys.end());
+		size_type bytes = mallinfo2().uordblks - before;
+
+		size_type found = 0;
+		double seconds = time_seconds([&] {
+			for (const std::string& key : queries) {
+				adt::binary_search_tree<std::string>::const_iterator cit;
+				bst.interleaved_find(&key, &key + 1, &cit, 1);
+				found += (cit != bst.cend());
+			}
+		});
+		print_row("binary_search_tree lookup", n, seconds);
+		std::cout << "    " << std::setprecision(2) << static_cast<double>(bytes) / n << " bytes/key\n";
+
+		if (found == std::numeric_limits<size_type>::max()) {
+			std::cout << found;
+		}
+	}
+
+	front_coded_lookups<4>(keys, queries);
+	front_coded_lookups<16>(keys, queries);
+	front_coded_lookups<64>(keys, queries);
+
+	return 0;
+}
+
+int splay(size_type n) {
+	using splay_search_tree = adt::splay_search_tree<value_type>;
+
+	std::vector<value_type> keys = shuffled_keys(n, seed);
+	std::vector<value_type> sorted(n);
+	std::iota(sorted.begin(), sorted.end(), 0);
+
+	// Zipf(0.99) is the workload asked about; a steeper skew shows where splaying starts to pay off
+	for (double skew : {0.99, 1.2}) {
+		std::vector<value_type> queries = zipf_queries(n, n, skew, seed + 2);
+		std::cout << "splay: " << n << " keys, then " << n << " Zipf(" << std::setprecision(2) << skew
+				  << ") lookups\n";
+
+		// The unbalanced BST is built in random order through the non-splaying base insert
+		splay_search_tree unbalanced;
+		for (value_type key : keys) {
+			static_cast<binary_search_tree&>(unbalanced).insert(key);
+		}
+		splay_search_tree balanced(adt::bst_sorted_unique, sorted.begin(), sorted.end());
+
+		size_type found = 0;
+		double seconds = time_seconds([&] {
+			for (value_type key : queries) {
+				found += std::as_const(unbalanced).contains(key);
+			}
+		});
+		print_row("unbalanced lookup", n, seconds);
+
+		seconds = time_seconds([&] {
+			for (value_type key : queries) {
+				found += std::as_const(balanced).contains(key);
+			}
+		});
+		print_row("balanced lookup", n, seconds);
+
+		// Splaying the same two trees: the hot keys gather near the root whatever the starting shape
+		seconds = time_seconds([&] {
+			for (value_type key : queries) {
+				found += unbalanced.contains(key);
+			}
+		});
+		print_row("splay lookup, random build", n, seconds);
+
+		seconds = time_seconds([&] {
+			for (value_type key : queries) {
+				found += balanced.contains(key);
+			}
+		});
+		print_row("splay lookup, balanced build", n, seconds);
+
+		if (found != 4 * n) {
+			std::cout << "Found " << found << " of " << 4 * n << " keys\n";
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+int hot_cache(size_type n) {
+	std::vector<value_type> sorted(n);
+	std::iota(sorted.begin(), sorted.end(), 0);
+	binary_search_tree bst(adt::bst_sorted_unique, sorted.begin(), sorted.end());
+
+	std::vector<value_type> zipf = zipf_queries(n, n, 0.99, seed + 2);
+	std::vector<value_type> uniform(n);
+	std::mt19937 rng(seed + 3);
+	for (value_type& query : uniform) {
+		query = static_cast<value_type>(rng() % n);
+	}
+
+	std::cout << "hot_cache: " << n << " keys in a balanced BST, then " << n << " lookups\n";
+
+	for (auto [name, queries] : {std::pair{"Zipf(0.99)", &zipf}, std::pair{"uniform", &uniform}}) {
+		for (size_type slots : {size_type(0), size_type(1024), size_type(1) << 16}) {
+			if (slots == 0) {
+				bst.disable_hot_cache();
+			} else {
+				bst.enable_hot_cache(slots);
+			}
+
+			size_type found = 0;
+			double seconds = time_seconds([&] {
+				for (value_type key : *queries) {
+					found += bst.contains(key);
+				}
+			});
+
+			std::string label = std::string(name) + ((slots == 0) ? ", no cache" : ", " + std::to_string(slots) + " slots");
+			print_row(label, n, seconds);
+			if (slots != 0) {
+				std::cout << "    " << std::setprecision(1) << bst.hot_cache_stats().hit_rate() * 100 << "% hits\n";
+			}
+
+			if (found != n) {
+				std::cout << "Found " << found << " of " << n << " keys\n";
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+constexpr benchmark benchmarks[] = {
+	{"async_find", async_find},
+	{"finger_insert", finger_insert},
+	{"sorted_append", sorted_append},
+	{"priority_queue", priority_queue},
+	{"range_erase", range_erase},
+	{"erase_if", erase_if},
+	{"copy", copy},
+	{"parallel_build", parallel_build},
+	{"teardown", teardown},
+	{"persistent", persistent},
+	{"concurrent", concurrent},
+	{"lock_free", lock_free},
+	{"sharded", sharded},
+	{"rcu", rcu},
+	{"buffered", buffered},
+	{"snapshot", snapshot},
+	{"frozen", frozen},
+	{"compressed", compressed},
+	{"strings", strings},
+	{"splay", splay},
+	{"hot_cache", hot_cache},
+};
+
+int main(int argc, char* argv[]) {
+	// Usage: binary_search_tree_benchmarks.exe [benchmark] [size]
+	const char* name = (argc > 1) ? argv[1] : nullptr;
+	size_type n = (argc > 2) ? std::strtoull(argv[2], nullptr, 10) : default_size;
+	bool found = false;
+
+	for (const benchmark& bench : benchmarks) {
+		if (name == nullptr || std::strcmp(name, "all") == 0 || std::strcmp(name, bench.name) == 0) {
+			found = true;
+			if (int status = bench.run(n); status != 0) {
+				return status;
+			}
+			std::cout << '\n';
+		}
+	}
+
+	if (!found) {
+		std::cout << "Unknown benchmark: " << name << "\nTerminating...\n";
+		return 1;
+	}
+
+	return 0;
+}
@@ -6,6 +6,17 @@
 #include <vector>
 #include <forward_list>
 #include <list>
+#include <coroutine>
+#include <future>
+#include <execution>
+#include <numeric>
+#include <bit>
+#include <sstream>
+#include <random>
+#include <set>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
 
 #include "binary_search_tree.hpp"
 
@@ -41,6 +52,155 @@ using node_type = binary_search_tree::node_type;
 template<std::input_iterator Iterator = iterator, class NodeType = node_type>
 using insert_return_type = binary_search_tree::template insert_return_type<Iterator, NodeType>;
 
+struct pipeline_task {
+	struct promise_type {
+		pipeline_task get_return_object() noexcept { return pipeline_task(); }
+
+		std::suspend_never initial_suspend() const noexcept { return {}; }
+
+		std::suspend_never final_suspend() const noexcept { return {}; }
+
+		void return_void() const noexcept {}
+
+		void unhandled_exception() const noexcept { std::terminate(); }
+	};
+};
+
+// Counts how often it is copied or moved, to check that values are built in their nodes
+struct counted_value {
+	static inline size_type copies = 0;
+
+	static inline size_type moves = 0;
+
+	value_type value;
+
+	int tag;
+
+	counted_value(value_type value, int tag) noexcept : value(value), tag(tag) {}
+
+	counted_value(const counted_value& other) noexcept : value(other.value), tag(other.tag) { copies++; }
+
+	counted_value(counted_value&& other) noexcept : value(other.value), tag(other.tag) { moves++; }
+
+	counted_value& operator=(const counted_value& rhs) noexcept = default;
+
+	counted_value& operator=(counted_value&& rhs) noexcept = default;
+
+	static void reset() noexcept { copies = moves = 0; }
+
+	friend bool operator==(const counted_value& lhs, const counted_value& rhs) noexcept {
+		return lhs.value == rhs.value;
+	}
+
+	friend auto operator<=>(const counted_value& lhs, const counted_value& rhs) noexcept {
+		return lhs.value <=> rhs.value;
+	}
+};
+
+// Throws from its copy constructor once a budget of copies shared by every thread runs out
+struct throwing_value {
+	static inline std::atomic<long> copies_left = -1;
+
+	value_type value;
+
+	throwing_value(value_type value) noexcept : value(value) {}
+
+	throwing_value(const throwing_value& other) : value(other.value) {
+		if (copies_left.fetch_sub(1) == 0) {
+			throw std::runtime_error("throwing_value: copy budget exhausted");
+		}
+	}
+
+	throwing_value& operator=(const throwing_value& rhs) noexcept = default;
+
+	friend bool operator==(const throwing_value& lhs, const throwing_value& rhs) noexcept = default;
+
+	friend auto operator<=>(const throwing_value& lhs, const throwing_value& rhs) noexcept = default;
+};
+
+// Counts the nodes every BST using counting_allocator allocates and frees, whatever type they are rebound to, and
+// how often the allocator itself is copied
+struct allocation_counter {
+	static inline size_type allocations = 0;
+
+	static inline size_type deallocations = 0;
+
+	static inline size_type copies = 0;
+
+	static void reset() noexcept { allocations = deallocations = copies = 0; }
+};
+
+template<class U>
+struct counting_allocator {
+	using value_type = U;
+
+	counting_allocator() noexcept = default;
+
+	counting_allocator(const counting_allocator&) noexcept { allocation_counter::copies++; }
+
+	template<class V>
+	counting_allocator(const counting_allocator<V>&) noexcept { allocation_counter::copies++; }
+
+	U* allocate(size_type n) {
+		allocation_counter::allocations += n;
+		return std::allocator<U>().allocate(n);
+	}
+
+	void deallocate(U* p, size_type n) noexcept {
+		allocation_counter::deallocations += n;
+		std::allocator<U>().deallocate(p, n);
+	}
+
+	template<class V>
+	bool operator==(const counting_allocator<V>&) const noexcept { return true; }
+};
+
+// Notes whether any tagged_allocator, whatever type it is rebound to, was used off the thread that owns its BST
+struct allocator_owner {
+	static inline std::thread::id thread;
+
+	static inline std::atomic<bool> shared = false;
+
+	static void reset() noexcept {
+		thread = std::this_thread::get_id();
+		shared = false;
+	}
+};
+
+// A stateful allocator, so instances are not always equal
+template<class U>
+struct tagged_allocator {
+	using value_type = U;
+
+	int tag = 0;
+
+	tagged_allocator() noexcept = default;
+
+	explicit tagged_allocator(int tag) noexcept : tag(tag) {}
+
+	template<class V>
+	tagged_allocator(const tagged_allocator<V>& other) noexcept : tag(other.tag) {}
+
+	tagged_allocator select_on_container_copy_construction() const noexcept { return tagged_allocator(this->tag + 1); }
+
+	U* allocate(size_type n) {
+		if (std::this_thread::get_id() != allocator_owner::thread) {
+			allocator_owner::shared = true;
+		}
+		return std::allocator<U>().allocate(n);
+	}
+
+	void deallocate(U* p, size_type n) noexcept {
+		if (std::this_thread::get_id() != allocator_owner::thread) {
+			allocator_owner::shared = true;
+		}
+		std::allocator<U>().deallocate(p, n);
+	}
+
+	template<class V>
+	bool operator==(const tagged_allocator<V>& rhs) const noexcept { return this->tag == rhs.tag; }
+};
+
 /* ---------------------------------------------Variables---------------------------------------------------- */
 constexpr std::initializer_list<value_type> empty_init;
 
@@ -250,6 +410,26 @@ void set_insertion_matcher(const std::initializer_list<value_type>& init_list,
 	}
 }
 
+pipeline_task await_find(const binary_search_tree& bst, value_type value, const_iterator& result) {
+	result = co_await bst.async_find(value);
+}
+
+size_type get_height(const binary_search_tree& bst) {
+	size_type height = 0;
+
+	// Each suspension of a lookup corresponds to one level below the root
+	for (value_type value : bst) {
+		binary_search_tree::find_task task = bst.async_find(value);
+		size_type depth = 1;
+		while (task.resume()) {
+			depth++;
+		}
+		height = std::max(height, depth);
+	}
+
+	return height;
+}
+
 /* --------------------------------Constant Iterator Constructors Tests-------------------------------------- */
 TEST(binary_search_tree__const_iterator__constructors, default_constructor) {
 	adt::binary_search_tree<int>::const_iterator cit;
@@ -3574,6 +3754,166 @@ TEST(binary_search_tree__constructors, copy_constructor__filled) {
 	EXPECT_EQ(dst, filled_inorder_matcher);
 }
 
+TEST(binary_search_tree__constructors, copy_constructor__filled_preserves_shape) {
+	binary_search_tree src(filled_init);
+	binary_search_tree dst(src);
+
+	EXPECT_TRUE(std::equal(filled_preorder_matcher.begin(), filled_preorder_matcher.end(), 
+						   dst.cbegin(adt::bst_traversals::preorder), dst.cend()));
+	EXPECT_EQ(*dst.cbegin(), *src.cbegin());
+	EXPECT_EQ(*dst.crbegin(), *src.crbegin());
+}
+
+TEST(binary_search_tree__constructors, copy_constructor__degenerate) {
+	constexpr size_type degenerate_size = 300000;
+	binary_search_tree src;
+	for (size_type i = 0; i < degenerate_size; i++) {
+		src.push_back_unchecked(static_cast<value_type>(i));
+	}
+
+	// A chain this deep would overflow the stack of a recursive copy
+	binary_search_tree dst(src);
+
+	EXPECT_EQ(dst.size(), degenerate_size);
+	EXPECT_TRUE(std::equal(src.cbegin(), src.cend(), dst.cbegin(), dst.cend()));
+	EXPECT_EQ(*dst.crbegin(), static_cast<value_type>(degenerate_size - 1));
+}
+
+TEST(binary_search_tree__constructors, copy_constructor__balanced_shape) {
+	binary_search_tree src;
+	for (value_type value = 0; value < 1000; value++) {
+		src.push_back_unchecked(value);
+	}
+
+	binary_search_tree dst(src, adt::bst_shapes::balanced);
+
+	EXPECT_EQ(dst.size(), 1000);
+	EXPECT_TRUE(std::equal(src.cbegin(), src.cend(), dst.cbegin(), dst.cend()));
+	EXPECT_EQ(*dst.cbegin(), 0);
+	EXPECT_EQ(*dst.crbegin(), 999);
+	EXPECT_EQ(get_height(dst), 10);
+}
+
+TEST(binary_search_tree__constructors, copy_constructor__balanced_empty) {
+	binary_search_tree src;
+	binary_search_tree dst(src, adt::bst_shapes::balanced);
+
+	EXPECT_TRUE(dst.empty());
+	EXPECT_EQ(dst.cbegin(), dst.cend());
+}
+
+TEST(binary_search_tree__constructors, copy_constructor__parallel__filled) {
+	binary_search_tree src(filled_init);
+	binary_search_tree dst(std::execution::par, src, 4);
+
+	EXPECT_EQ(dst.size(), filled_size);
+	EXPECT_EQ(dst, filled_inorder_matcher);
+	EXPECT_TRUE(std::equal(filled_preorder_matcher.begin(), filled_preorder_matcher.end(), 
+						   dst.cbegin(adt::bst_traversals::preorder), dst.cend()));
+}
+
+TEST(binary_search_tree__constructors, copy_constructor__parallel__degenerate) {
+	binary_search_tree src;
+	for (value_type value = 0; value < 100000; value++) {
+		src.push_back_unchecked(value);
+	}
+
+	binary_search_tree dst(std::execution::par, src);
+
+	EXPECT_EQ(dst.size(), 100000);
+	EXPECT_TRUE(std::equal(src.cbegin(), src.cend(), dst.cbegin(), dst.cend()));
+}
+
+TEST(binary_search_tree__constructors, sorted_constructor__empty) {
+	std::vector<value_type> values;
+	binary_search_tree bst(adt::bst_sorted_unique, values.begin(), values.end());
+
+	EXPECT_TRUE(bst.empty());
+	EXPECT_EQ(bst.cbegin(), bst.cend());
+}
+
+TEST(binary_search_tree__constructors, sorted_constructor__filled) {
+	std::vector<value_type> values(filled_inorder_matcher.begin(), filled_inorder_matcher.end());
+	binary_search_tree bst(adt::bst_sorted_unique, values.begin(), values.end());
+
+	EXPECT_EQ(bst.size(), filled_size);
+	EXPECT_EQ(bst, filled_inorder_matcher);
+	EXPECT_EQ(get_height(bst), std::bit_width(filled_size));
+}
+
+TEST(binary_search_tree__constructors, sorted_constructor__parallel) {
+	std::vector<value_type> values(100000);
+	std::iota(values.begin(), values.end(), 0);
+
+	binary_search_tree sequential(std::execution::seq, adt::bst_sorted_unique, values.begin(), values.end(), 8);
+	binary_search_tree parallel(std::execution::par, adt::bst_sorted_unique, values.begin(), values.end(), 8);
+
+	EXPECT_EQ(parallel.size(), values.size());
+	EXPECT_TRUE(std::equal(values.begin(), values.end(), parallel.cbegin(), parallel.cend()));
+	EXPECT_TRUE(std::equal(sequential.cbegin(adt::bst_traversals::preorder), sequential.cend(),
+						   parallel.cbegin(adt::bst_traversals::preorder), parallel.cend()));
+	EXPECT_EQ(*parallel.cbegin(), 0);
+	EXPECT_EQ(*parallel.crbegin(), 99999);
+	EXPECT_NE(parallel.find(54321), parallel.cend());
+}
+
+TEST(binary_search_tree__constructors, sorted_constructor__throwing_copy) {
+	using throwing_tree = adt::binary_search_tree<throwing_value>;
+	std::vector<throwing_value> values;
+	for (value_type value = 0; value < 100000; value++) {
+		values.emplace_back(value);
+	}
+
+	// A copy that throws on either thread, or deep in a sequential build, frees every node built so far
+	for (long budget : {0L, 500L, 30000L, 70000L}) {
+		throwing_value::copies_left = budget;
+		EXPECT_THROW(throwing_tree(std::execution::par, adt::bst_sorted_unique, values.begin(), values.end(), 8),
+					 std::runtime_error);
+
+		throwing_value::copies_left = budget;
+		EXPECT_THROW(throwing_tree(adt::bst_sorted_unique, values.begin(), values.end()), std::runtime_error);
+	}
+	throwing_value::copies_left = -1;
+}
+
+TEST(binary_search_tree__constructors, copy_constructor__parallel__throwing_copy) {
+	using throwing_tree = adt::binary_search_tree<throwing_value>;
+	std::vector<throwing_value> values;
+	for (value_type value = 0; value < 100000; value++) {
+		values.emplace_back(value);
+	}
+	throwing_tree src(adt::bst_sorted_unique, values.begin(), values.end());
+
+	// The joining thread rethrows the first failure once both halves have finished
+	for (long budget : {0L, 500L, 30000L, 70000L}) {
+		throwing_value::copies_left = budget;
+		EXPECT_THROW(throwing_tree(std::execution::par, src, 8), std::runtime_error);
+	}
+	throwing_value::copies_left = -1;
+
+	throwing_tree dst(std::execution::par, src, 8);
+	EXPECT_EQ(dst.size(), values.size());
+	EXPECT_TRUE(std::equal(src.cbegin(), src.cend(), dst.cbegin(), dst.cend()));
+}
+
+TEST(binary_search_tree__constructors, parallel_constructors__stateful_allocator) {
+	using tagged_tree = adt::binary_search_tree<value_type, tagged_allocator<value_type>>;
+	std::vector<value_type> values(100000);
+	std::iota(values.begin(), values.end(), 0);
+	allocator_owner::reset();
+
+	// An allocator that is not always equal is never shared with worker threads
+	tagged_tree src(std::execution::par, adt::bst_sorted_unique, values.begin(), values.end(), 8);
+	tagged_tree dst(std::execution::par, src, 8);
+
+	EXPECT_FALSE(allocator_owner::shared);
+	EXPECT_EQ(dst.size(), values.size());
+	EXPECT_TRUE(std::equal(src.cbegin(), src.cend(), dst.cbegin(), dst.cend()));
+
+	// The copy takes the allocator its source selects for copies
+	EXPECT_EQ(dst.get_allocator().tag, src.get_allocator().tag + 1);
+}
+
 TEST(binary_search_tree__constructors, move_constructor__empty) {
 	std::initializer_list<int> matcher = {};
 	adt::binary_search_tree<int> src = {};
@@ -3804,6 +4144,47 @@ TEST(binary_search_tree__operators, assignment_operator__initializer_list__fille
 	EXPECT_EQ(bst, filled_inorder_matcher);
 }
 
+TEST(binary_search_tree__operators, assignment_operator__bst__reuses_nodes) {
+	using counting_bst = adt::binary_search_tree<int, counting_allocator<int>>;
+	counting_bst same = {4, 2, 6, 1, 3, 5, 7};
+	counting_bst fewer = {2, 1, 3};
+	counting_bst more = {8, 4, 12, 2, 6, 10, 14, 1, 3};
+	counting_bst dst = {100, 20, 10, 30, 200, 150, 300};
+	allocation_counter::reset();
+
+	// A source of the same size is copied entirely into the destination's existing nodes
+	dst = same;
+	EXPECT_EQ(dst, same);
+	EXPECT_EQ(allocation_counter::allocations, 0);
+	EXPECT_EQ(allocation_counter::deallocations, 0);
+
+	// Only the surplus is freed...
+	dst = fewer;
+	EXPECT_EQ(dst, fewer);
+	EXPECT_EQ(allocation_counter::allocations, 0);
+	EXPECT_EQ(allocation_counter::deallocations, 4);
+
+	// ...and only the shortfall is allocated
+	dst = more;
+	EXPECT_EQ(dst, more);
+	EXPECT_EQ(dst.size(), 9);
+	EXPECT_EQ(allocation_counter::allocations, 6);
+	EXPECT_EQ(allocation_counter::deallocations, 4);
+}
+
+TEST(binary_search_tree__operators, assignment_operator__initializer_list__reuses_nodes) {
+	adt::binary_search_tree<std::string, counting_allocator<std::string>> bst = {"d", "b", "f", "a", "c"};
+	allocation_counter::reset();
+
+	// Duplicates hand their node back, so five values with three distinct keys free two of the five nodes
+	bst = {"y", "x", "y", "z", "x"};
+
+	EXPECT_EQ(bst, std::initializer_list<std::string>({"x", "y", "z"}));
+	EXPECT_EQ(bst.size(), 3);
+	EXPECT_EQ(allocation_counter::allocations, 0);
+	EXPECT_EQ(allocation_counter::deallocations, 2);
+}
+
 TEST(binary_search_tree__operators, move_operator__self_assignment) {
 	std::initializer_list<int> matcher = {10, 20, 30, 100, 150, 200, 300};
 	adt::binary_search_tree<int> bst = {100, 20, 10, 30, 200, 150, 300};
@@ -4539,6 +4920,156 @@ TEST(binary_search_tree__methods, clear__filled_bst) {
 	EXPECT_THROW(static_cast<void>(*bst.begin()), std::runtime_error);
 }
 
+TEST(binary_search_tree__methods, clear__parallel__empty_bst) {
+	binary_search_tree bst;
+
+	bst.clear(std::execution::par, 4);
+
+	EXPECT_TRUE(bst.empty());
+	EXPECT_EQ(bst.size(), 0);
+}
+
+TEST(binary_search_tree__methods, clear__parallel__filled_bst) {
+	binary_search_tree bst = filled_init;
+
+	bst.clear(std::execution::par, 4);
+
+	EXPECT_TRUE(bst.empty());
+	EXPECT_EQ(bst.size(), 0);
+	EXPECT_EQ(bst, empty_matcher);
+
+	bst.insert(101);
+	EXPECT_EQ(bst.size(), 1);
+}
+
+TEST(binary_search_tree__methods, clear__parallel__stateful_allocator) {
+	using tagged_tree = adt::binary_search_tree<value_type, tagged_allocator<value_type>>;
+	std::vector<value_type> values(100000);
+	std::iota(values.begin(), values.end(), 0);
+	allocator_owner::reset();
+
+	// Every node goes back through the BST's own allocator on this thread
+	tagged_tree bst(adt::bst_sorted_unique, values.begin(), values.end());
+	bst.clear(std::execution::par, 8);
+
+	EXPECT_FALSE(allocator_owner::shared);
+	EXPECT_TRUE(bst.empty());
+}
+
+TEST(binary_search_tree__methods, clear_async__empty_bst) {
+	binary_search_tree bst;
+
+	std::future<size_type> reclaimed = bst.clear_async();
+
+	EXPECT_TRUE(bst.empty());
+	EXPECT_EQ(reclaimed.get(), 0);
+}
+
+TEST(binary_search_tree__methods, clear_async__filled_bst) {
+	binary_search_tree bst = filled_init;
+
+	std::future<size_type> reclaimed = bst.clear_async();
+
+	// The BST is empty and usable as soon as clear_async() returns
+	EXPECT_TRUE(bst.empty());
+	EXPECT_EQ(bst.size(), 0);
+	EXPECT_EQ(bst, empty_matcher);
+
+	bst.insert(101);
+	EXPECT_EQ(bst.size(), 1);
+	EXPECT_EQ(*bst.cbegin(), 101);
+
+	EXPECT_EQ(reclaimed.get(), filled_size);
+}
+
+TEST(binary_search_tree__methods, save_and_load__empty_bst) {
+	binary_search_tree bst;
+	binary_search_tree loaded = filled_init;
+	std::stringstream stream;
+
+	bst.save(stream);
+	loaded.load(stream);
+
+	EXPECT_TRUE(loaded.empty());
+	EXPECT_EQ(loaded, empty_matcher);
+}
+
+TEST(binary_search_tree__methods, save_and_load__filled_bst) {
+	binary_search_tree bst = filled_init;
+	binary_search_tree loaded;
+	std::stringstream stream;
+
+	bst.save(stream);
+
+	// Header (8 byte magic, version, type tag, count), payload and checksum trailer
+	EXPECT_EQ(stream.str().size(), 8 + 4 + 4 + 8 + filled_size * sizeof(value_type) + 8);
+
+	loaded.load(stream);
+
+	EXPECT_EQ(loaded.size(), filled_size);
+	EXPECT_EQ(loaded, filled_inorder_matcher);
+	EXPECT_EQ(loaded.peek_min(), filled_inorder_matcher.front());
+	EXPECT_EQ(loaded.peek_max(), filled_inorder_matcher.back());
+
+	// The loaded BST is built balanced
+	EXPECT_EQ(get_height(loaded), std::bit_width(filled_size));
+}
+
+TEST(binary_search_tree__methods, save_and_load__multiple_chunks) {
+	std::vector<value_type> values(20000);
+	std::iota(values.begin(), values.end(), -10000);
+	binary_search_tree bst(values.begin(), values.end());
+	binary_search_tree loaded;
+	std::stringstream stream;
+
+	bst.save(stream);
+	loaded.load(stream);
+
+	EXPECT_EQ(loaded.size(), values.size());
+	EXPECT_TRUE(std::equal(loaded.cbegin(), loaded.cend(), values.begin(), values.end()));
+}
+
+TEST(binary_search_tree__methods, load__corrupt_snapshot) {
+	binary_search_tree bst = filled_init;
+	std::stringstream stream;
+	bst.save(stream);
+	std::string snapshot = stream.str();
+
+	auto load = [](const std::string& bytes) {
+		binary_search_tree loaded = single_init;
+		std::stringstream stream(bytes);
+
+		try {
+			loaded.load(stream);
+		} catch (const std::runtime_error&) {
+			// A failed load leaves the BST unchanged
+			EXPECT_EQ(loaded, single_matcher);
+			throw;
+		}
+	};
+
+	std::string bad_magic = snapshot;
+	bad_magic[0] = 'x';
+	EXPECT_THROW(load(bad_magic), std::runtime_error);
+
+	std::string bad_version = snapshot;
+	bad_version[8] = 2;
+	EXPECT_THROW(load(bad_version), std::runtime_error);
+
+	std::string bad_payload = snapshot;
+	bad_payload[24] ^= 1;
+	EXPECT_THROW(load(bad_payload), std::runtime_error);
+
+	EXPECT_THROW(load(snapshot.substr(0, snapshot.size() - 1)), std::runtime_error);
+	EXPECT_NO_THROW(load(snapshot));
+
+	// A snapshot of another value type is rejected
+	adt::binary_search_tree<long long> wide = {1, 2, 3};
+	std::stringstream wide_stream;
+	wide.save(wide_stream);
+	EXPECT_THROW(load(wide_stream.str()), std::runtime_error);
+}
+
 TEST(binary_search_tree__methods, insert__lref__empty_bst) {
 	adt::binary_search_tree<int> bst;
 	adt::binary_search_tree<int>::const_reference lref = 101;
@@ -4926,6 +5457,56 @@ TEST(binary_search_tree__methods, insert__rref_and_const_iterator__filled_bst) {
 	EXPECT_EQ(*it, insertion_value);
 }
 
+TEST(binary_search_tree__methods, insert__lref_and_const_iterator__distant_hint) {
+	std::initializer_list<value_type> values = {0, 6, 34, 46, 56, 102};
+
+	for (size_type i = 0; i < filled_inorder_matcher.size(); i++) {
+		for (value_type value : values) {
+			binary_search_tree bst = filled_init;
+			binary_search_tree matcher = filled_init;
+			const_iterator pos = bst.find(filled_inorder_matcher[i]);
+
+			matcher.insert(value);
+			iterator it = bst.insert(pos, value);
+
+			EXPECT_NE(it, bst.end());
+			EXPECT_EQ(*it, value);
+			EXPECT_EQ(bst.size(), matcher.size());
+			EXPECT_TRUE(std::equal(bst.begin(adt::bst_traversals::preorder), bst.end(),
+								   matcher.begin(adt::bst_traversals::preorder), matcher.end()));
+		}
+	}
+}
+
+TEST(binary_search_tree__methods, insert__lref_and_const_iterator__duplicate_hint) {
+	for (size_type i = 0; i < filled_inorder_matcher.size(); i++) {
+		binary_search_tree bst = filled_init;
+		const_iterator pos = bst.find(filled_inorder_matcher[filled_size - 1 - i]);
+
+		iterator it = bst.insert(pos, filled_inorder_matcher[i]);
+
+		EXPECT_EQ(*it, filled_inorder_matcher[i]);
+		EXPECT_EQ(bst.size(), filled_size);
+		EXPECT_EQ(bst, filled_inorder_matcher);
+	}
+}
+
+TEST(binary_search_tree__methods, insert__lref_and_const_iterator__end_hint) {
+	binary_search_tree bst;
+	std::vector<value_type> matcher;
+
+	for (value_type value = 0; value < 100; value++) {
+		iterator it = bst.insert(bst.cend(), value);
+		matcher.push_back(value);
+
+		EXPECT_EQ(*it, value);
+		EXPECT_EQ(bst.get_max().value(), value);
+	}
+
+	EXPECT_EQ(bst.size(), matcher.size());
+	EXPECT_EQ(bst, matcher);
+}
+
 TEST(binary_search_tree__methods, insert__iterators__valid_iterators) {
 	adt::binary_search_tree<int> bst;
 	std::vector<int> vec = {100, 20, 10, 30, 200, 150, 300};
@@ -5215,6 +5796,80 @@ TEST(binary_search_tree__methods, insert__node_handle_and_const_iterator__failed
 	EXPECT_EQ(dst, matcher);
 }
 
+TEST(binary_search_tree__methods, insert__lref__new_extremes) {
+	binary_search_tree bst = filled_init;
+	binary_search_tree matcher = filled_init;
+	std::vector<value_type> values = {0, 102, -1, 103};
+
+	for (value_type value : values) {
+		// Hinting with the root forces a full descent, which must place the value in the same spot
+		std::pair<iterator, bool> pair = bst.insert(value);
+		matcher.insert(matcher.find(filled_preorder_matcher[0]), value);
+
+		EXPECT_TRUE(pair.second);
+		EXPECT_EQ(*pair.first, value);
+	}
+
+	EXPECT_EQ(bst.get_min().value(), -1);
+	EXPECT_EQ(bst.get_max().value(), 103);
+	EXPECT_EQ(bst.size(), filled_size + values.size());
+	EXPECT_TRUE(std::equal(bst.begin(adt::bst_traversals::preorder), bst.end(),
+						   matcher.begin(adt::bst_traversals::preorder), matcher.end()));
+}
+
+TEST(binary_search_tree__methods, push_back_unchecked__empty_bst) {
+	binary_search_tree bst;
+
+	iterator it = bst.push_back_unchecked(101);
+
+	EXPECT_EQ(*it, 101);
+	EXPECT_EQ(bst.size(), 1);
+	EXPECT_EQ(bst.get_root().value(), 101);
+	EXPECT_EQ(bst.get_min().value(), 101);
+	EXPECT_EQ(bst.get_max().value(), 101);
+}
+
+TEST(binary_search_tree__methods, push_back_unchecked__filled_bst) {
+	binary_search_tree bst = filled_init;
+	std::vector<value_type> matcher(filled_inorder_matcher.begin(), filled_inorder_matcher.end());
+
+	for (value_type value = 102; value < 110; value++) {
+		iterator it = bst.push_back_unchecked(value);
+		matcher.push_back(value);
+
+		EXPECT_EQ(*it, value);
+		EXPECT_EQ(bst.get_max().value(), value);
+	}
+
+	EXPECT_EQ(bst.size(), matcher.size());
+	EXPECT_EQ(bst, matcher);
+	EXPECT_EQ(bst.get_min().value(), filled_inorder_matcher[0]);
+}
+
+TEST(binary_search_tree__methods, append_sorted__empty_bst) {
+	binary_search_tree bst;
+	std::vector<value_type> values(filled_inorder_matcher.begin(), filled_inorder_matcher.end());
+
+	EXPECT_EQ(bst.append_sorted(values.begin(), values.end()), filled_size);
+
+	EXPECT_EQ(bst.size(), filled_size);
+	EXPECT_EQ(bst, filled_inorder_matcher);
+}
+
+TEST(binary_search_tree__methods, append_sorted__unsorted_values) {
+	binary_search_tree bst = filled_init;
+	std::vector<value_type> values = {101, 102, 46, 102, 0, 110, 50};
+	std::set<value_type> matcher = filled_init;
+	matcher.insert(values.begin(), values.end());
+
+	EXPECT_EQ(bst.append_sorted(values.begin(), values.end()), 4);
+
+	EXPECT_EQ(bst.size(), matcher.size());
+	EXPECT_EQ(bst, matcher);
+	EXPECT_EQ(bst.get_min().value(), 0);
+	EXPECT_EQ(bst.get_max().value(), 110);
+}
+
 TEST(binary_search_tree__methods, insert_range__empty_bst) {
 	adt::binary_search_tree<int> bst;
 	std::vector<int> vec = {101};
@@ -5351,6 +6006,55 @@ TEST(binary_search_tree__methods, emplace__failed_emplacement) {
 	EXPECT_EQ(*pair.first, 101);
 }
 
+TEST(binary_search_tree__methods, emplace__constructs_in_place) {
+	adt::binary_search_tree<counted_value> bst;
+	for (value_type value : filled_init) {
+		bst.emplace(value, 0);
+	}
+	counted_value::reset();
+
+	// Both the fast path past the maximum and a descent from the root build the value once, in its node
+	EXPECT_TRUE(bst.emplace(102, 1).second);
+	EXPECT_TRUE(bst.emplace(34, 1).second);
+	EXPECT_TRUE(bst.emplace_hint(bst.cbegin(), 6, 1) != bst.end());
+
+	EXPECT_EQ(counted_value::copies, 0);
+	EXPECT_EQ(counted_value::moves, 0);
+	EXPECT_EQ(bst.size(), filled_init.size() + 3);
+	EXPECT_TRUE(std::is_sorted(bst.begin(), bst.end()));
+}
+
+TEST(binary_search_tree__methods, emplace__failed_emplacement__keeps_original) {
+	adt::binary_search_tree<counted_value> bst;
+	bst.emplace(50, 0);
+	bst.emplace(30, 0);
+	bst.emplace(70, 0);
+	counted_value::reset();
+
+	// The new node is freed before it is ever linked, and the stored value is untouched
+	std::pair<adt::binary_search_tree<counted_value>::iterator, bool> pair = bst.emplace(30, 1);
+
+	EXPECT_FALSE(pair.second);
+	EXPECT_EQ(pair.first->tag, 0);
+	EXPECT_EQ(bst.size(), 3);
+	EXPECT_EQ(counted_value::copies, 0);
+	EXPECT_EQ(counted_value::moves, 0);
+}
+
+TEST(binary_search_tree__methods, insert__rref__moves_once) {
+	adt::binary_search_tree<counted_value> bst;
+	bst.emplace(50, 0);
+	counted_value::reset();
+
+	bst.insert(counted_value(30, 0));
+	bst.insert(bst.cbegin(), counted_value(40, 0));
+	bst.insert(counted_value(60, 0));
+
+	EXPECT_EQ(counted_value::copies, 0);
+	EXPECT_EQ(counted_value::moves, 3);
+	EXPECT_EQ(bst.size(), 4);
+}
+
 TEST(binary_search_tree__methods, emplace_hint__empty_bst) {
 	adt::binary_search_tree<int> bst;
 	adt::binary_search_tree<int>::value_type value = 101;
@@ -5418,6 +6122,43 @@ TEST(binary_search_tree__methods, emplace_hint__filled_bst) {
 	EXPECT_EQ(*bst_it, insertion_value);
 }
 
+TEST(binary_search_tree__methods, emplace_hint__distant_hint) {
+	std::initializer_list<value_type> values = {0, 6, 34, 46, 56, 102};
+
+	for (size_type i = 0; i < filled_inorder_matcher.size(); i++) {
+		for (value_type value : values) {
+			binary_search_tree bst = filled_init;
+			binary_search_tree matcher = filled_init;
+			const_iterator pos = bst.find(filled_inorder_matcher[i]);
+
+			matcher.insert(value);
+			iterator it = bst.emplace_hint(pos, value);
+
+			EXPECT_EQ(*it, value);
+			EXPECT_EQ(bst.size(), matcher.size());
+			EXPECT_TRUE(std::equal(bst.begin(adt::bst_traversals::preorder), bst.end(),
+								   matcher.begin(adt::bst_traversals::preorder), matcher.end()));
+		}
+	}
+}
+
+TEST(binary_search_tree__methods, emplace__uses_the_node_allocator) {
+	adt::binary_search_tree<std::string, counting_allocator<std::string>> bst;
+	allocation_counter::reset();
+
+	// Nodes come from, and go back to, the BST's own node allocator rather than a copy made for each call; a
+	// duplicate is built in its node before it is found to be a duplicate, so every call allocates
+	for (int i = 0; i < 100; i++) {
+		bst.emplace(3, static_cast<char>('a' + i % 26));
+	}
+	bst.emplace_hint(bst.cbegin(), "aaa");
+	bst.clear();
+
+	EXPECT_EQ(allocation_counter::allocations, 101);
+	EXPECT_EQ(allocation_counter::deallocations, 101);
+	EXPECT_EQ(allocation_counter::copies, 0);
+}
+
 TEST(binary_search_tree__methods, erase__single_iterator__empty_bst) {
 	adt::binary_search_tree<int> bst;
 	adt::binary_search_tree<int>::iterator it;
@@ -5559,7 +6300,56 @@ TEST(binary_search_tree__methods, erase__iterator_range__single_node) {
 	adt::binary_search_tree<int> bst = {101};
 	adt::binary_search_tree<int>::iterator it;
 	
-	EXPECT_THROW(static_cast<void>(it = bst.erase(bst.begin(), bst.end())), std::invalid_argument);
+	EXPECT_NO_THROW(it = bst.erase(bst.begin(), bst.end()));
+
+	EXPECT_TRUE(bst.empty());
+	EXPECT_EQ(bst.size(), 0);
+	EXPECT_EQ(it, bst.end());
+	EXPECT_EQ(bst.get_root(), nullptr);
+	EXPECT_EQ(bst.get_min(), nullptr);
+	EXPECT_EQ(bst.get_max(), nullptr);
+}
+
+TEST(binary_search_tree__methods, erase__iterator_range__unreachable_end) {
+	binary_search_tree bst = filled_init;
+
+	EXPECT_THROW(static_cast<void>(bst.erase(bst.find(60), bst.find(30))), std::invalid_argument);
+	EXPECT_THROW(static_cast<void>(bst.erase(bst.end(), bst.find(30))), std::invalid_argument);
+	EXPECT_EQ(bst.size(), filled_size);
+	EXPECT_EQ(bst, filled_inorder_matcher);
+}
+
+TEST(binary_search_tree__methods, erase__iterator_range__all_subranges) {
+	for (size_type i = 0; i < filled_size; i++) {
+		for (size_type j = i + 1; j <= filled_size; j++) {
+			binary_search_tree bst = filled_init;
+			std::set<value_type> matcher = filled_init;
+			iterator first = bst.find(filled_inorder_matcher[i]);
+			iterator last = (j < filled_size) ? bst.find(filled_inorder_matcher[j]) : bst.end();
+
+			matcher.erase(matcher.find(filled_inorder_matcher[i]),
+						  (j < filled_size) ? matcher.find(filled_inorder_matcher[j]) : matcher.end());
+			bst_it = bst.erase(first, last);
+
+			EXPECT_EQ(bst_it, last);
+			EXPECT_EQ(bst.size(), matcher.size());
+			EXPECT_EQ(bst, matcher);
+			if (!matcher.empty()) {
+				EXPECT_EQ(bst.get_min().value(), *matcher.begin());
+				EXPECT_EQ(bst.get_max().value(), *matcher.rbegin());
+				EXPECT_EQ(bst.get_root().value(), *bst.begin(adt::bst_traversals::preorder));
+			} else {
+				EXPECT_EQ(bst.get_root(), nullptr);
+			}
+
+			// The remaining nodes must still form a valid BST, so every value is reachable by a descent
+			std::vector<const_iterator> results(matcher.size());
+			bst.interleaved_find(matcher.begin(), matcher.end(), results.begin());
+			for (const_iterator result : results) {
+				EXPECT_NE(result, bst.cend());
+			}
+		}
+	}
 }
 
 TEST(binary_search_tree__methods, erase__iterator_range__filled_bst) {
@@ -5616,7 +6406,11 @@ TEST(binary_search_tree__methods, erase__const_iterator_range__single_node) {
 	adt::binary_search_tree<int> bst = {101};
 	adt::binary_search_tree<int>::iterator it;
 	
-	EXPECT_THROW(static_cast<void>(it = bst.erase(bst.cbegin(), bst.cend())), std::invalid_argument);
+	EXPECT_NO_THROW(it = bst.erase(bst.cbegin(), bst.cend()));
+
+	EXPECT_TRUE(bst.empty());
+	EXPECT_EQ(bst.size(), 0);
+	EXPECT_EQ(it, bst.end());
 }
 
 TEST(binary_search_tree__methods, erase__const_iterator_range__filled_bst) {
@@ -5660,6 +6454,172 @@ TEST(binary_search_tree__methods, erase__const_iterator_range__filled_bst) {
 	EXPECT_EQ(bst_cit, bst.cend());
 }
 
+TEST(binary_search_tree__methods, erase__single_iterator__max_node_with_left_subtree) {
+	binary_search_tree bst = {50, 80, 60, 70, 65};
+
+	bst_it = bst.erase(bst.find(80));
+
+	EXPECT_EQ(bst_it, bst.end());
+	EXPECT_EQ(bst.get_max().value(), 70);
+	EXPECT_EQ(bst, std::vector<value_type>({50, 60, 65, 70}));
+}
+
+TEST(binary_search_tree__methods, peek_min__empty_bst) {
+	EXPECT_THROW(static_cast<void>(bst_empty.peek_min()), std::out_of_range);
+}
+
+TEST(binary_search_tree__methods, peek_min__filled_bst) {
+	EXPECT_EQ(bst_single.peek_min(), single_matcher[0]);
+	EXPECT_EQ(bst_filled.peek_min(), filled_inorder_matcher.front());
+}
+
+TEST(binary_search_tree__methods, peek_max__empty_bst) {
+	EXPECT_THROW(static_cast<void>(bst_empty.peek_max()), std::out_of_range);
+}
+
+TEST(binary_search_tree__methods, peek_max__filled_bst) {
+	EXPECT_EQ(bst_single.peek_max(), single_matcher[0]);
+	EXPECT_EQ(bst_filled.peek_max(), filled_inorder_matcher.back());
+}
+
+TEST(binary_search_tree__methods, pop_min__empty_bst) {
+	binary_search_tree bst;
+
+	EXPECT_THROW(static_cast<void>(bst.pop_min()), std::out_of_range);
+	EXPECT_TRUE(bst.empty());
+}
+
+TEST(binary_search_tree__methods, pop_min__single_node) {
+	binary_search_tree bst = single_init;
+
+	EXPECT_EQ(bst.pop_min(), single_matcher[0]);
+
+	EXPECT_TRUE(bst.empty());
+	EXPECT_EQ(bst.get_root(), nullptr);
+	EXPECT_EQ(bst.get_min(), nullptr);
+	EXPECT_EQ(bst.get_max(), nullptr);
+}
+
+TEST(binary_search_tree__methods, pop_min__filled_bst) {
+	binary_search_tree bst = filled_init;
+	std::list<value_type> values_matcher(filled_inorder_matcher.begin(), filled_inorder_matcher.end());
+
+	while (!values_matcher.empty()) {
+		EXPECT_EQ(bst.pop_min(), values_matcher.front());
+		values_matcher.pop_front();
+
+		EXPECT_EQ(bst.size(), values_matcher.size());
+		EXPECT_EQ(bst, values_matcher);
+		if (!values_matcher.empty()) {
+			EXPECT_EQ(bst.peek_min(), values_matcher.front());
+			EXPECT_EQ(bst.peek_max(), values_matcher.back());
+		}
+	}
+
+	EXPECT_TRUE(bst.empty());
+	EXPECT_EQ(bst.get_root(), nullptr);
+}
+
+TEST(binary_search_tree__methods, pop_max__empty_bst) {
+	binary_search_tree bst;
+
+	EXPECT_THROW(static_cast<void>(bst.pop_max()), std::out_of_range);
+	EXPECT_TRUE(bst.empty());
+}
+
+TEST(binary_search_tree__methods, pop_max__filled_bst) {
+	binary_search_tree bst = filled_init;
+	std::list<value_type> values_matcher(filled_inorder_matcher.begin(), filled_inorder_matcher.end());
+
+	while (!values_matcher.empty()) {
+		EXPECT_EQ(bst.pop_max(), values_matcher.back());
+		values_matcher.pop_back();
+
+		EXPECT_EQ(bst.size(), values_matcher.size());
+		EXPECT_EQ(bst, values_matcher);
+		if (!values_matcher.empty()) {
+			EXPECT_EQ(bst.peek_min(), values_matcher.front());
+			EXPECT_EQ(bst.peek_max(), values_matcher.back());
+		}
+	}
+
+	EXPECT_TRUE(bst.empty());
+	EXPECT_EQ(bst.get_root(), nullptr);
+}
+
+TEST(binary_search_tree__methods, pop_min_and_pop_max__alternating) {
+	binary_search_tree bst = filled_init;
+	std::list<value_type> values_matcher(filled_inorder_matcher.begin(), filled_inorder_matcher.end());
+
+	for (size_type i = 0; !values_matcher.empty(); i++) {
+		if (i % 2 == 0) {
+			EXPECT_EQ(bst.pop_min(), values_matcher.front());
+			values_matcher.pop_front();
+		} else {
+			EXPECT_EQ(bst.pop_max(), values_matcher.back());
+			values_matcher.pop_back();
+		}
+
+		EXPECT_EQ(bst, values_matcher);
+		if (!values_matcher.empty()) {
+			EXPECT_EQ(bst.get_min().value(), values_matcher.front());
+			EXPECT_EQ(bst.get_max().value(), values_matcher.back());
+		}
+	}
+
+	EXPECT_TRUE(bst.empty());
+}
+
+TEST(binary_search_tree__methods, erase_if__empty_bst) {
+	binary_search_tree bst;
+
+	EXPECT_EQ(bst.erase_if([](const_reference) { return true; }), 0);
+	EXPECT_TRUE(bst.empty());
+}
+
+TEST(binary_search_tree__methods, erase_if__no_matches) {
+	binary_search_tree bst = filled_init;
+
+	EXPECT_EQ(bst.erase_if([](const_reference value) { return value > 101; }), 0);
+
+	EXPECT_EQ(bst.size(), filled_size);
+	EXPECT_TRUE(std::equal(bst.begin(adt::bst_traversals::preorder), bst.end(),
+						   filled_preorder_matcher.begin(), filled_preorder_matcher.end()));
+}
+
+TEST(binary_search_tree__methods, erase_if__all_matches) {
+	binary_search_tree bst = filled_init;
+
+	EXPECT_EQ(bst.erase_if([](const_reference) { return true; }), filled_size);
+
+	EXPECT_TRUE(bst.empty());
+	EXPECT_EQ(bst.get_root(), nullptr);
+	EXPECT_EQ(bst.get_min(), nullptr);
+	EXPECT_EQ(bst.get_max(), nullptr);
+}
+
+TEST(binary_search_tree__methods, erase_if__filled_bst) {
+	binary_search_tree bst = filled_init;
+	std::set<value_type> matcher = filled_init;
+	auto is_odd = [](const_reference value) { return value % 2 != 0; };
+	size_type erased = std::erase_if(matcher, is_odd);
+
+	EXPECT_EQ(std::erase_if(bst, is_odd), erased);
+
+	EXPECT_EQ(bst.size(), matcher.size());
+	EXPECT_EQ(bst, matcher);
+	EXPECT_EQ(bst.get_min().value(), *matcher.begin());
+	EXPECT_EQ(bst.get_max().value(), *matcher.rbegin());
+
+	// The survivors are relinked into a balanced BST in which every value can still be found
+	std::vector<const_iterator> results(matcher.size());
+	bst.interleaved_find(matcher.begin(), matcher.end(), results.begin());
+	for (const_iterator result : results) {
+		EXPECT_NE(result, bst.cend());
+	}
+	EXPECT_LE(get_height(bst), 5);
+}
+
 TEST(binary_search_tree__methods, swap__empty_to_empty) {
 	adt::binary_search_tree<int> bst1,
 								 bst1_orig = bst1,
@@ -5998,6 +6958,98 @@ TEST(binary_search_tree__methods, find__const_iterator__filled_bst) {
 	}
 }
 
+TEST(binary_search_tree__methods, async_find__empty_bst) {
+	binary_search_tree::find_task task = bst_empty.async_find(0);
+
+	EXPECT_FALSE(task.done());
+	EXPECT_THROW(static_cast<void>(task.get()), std::runtime_error);
+
+	while (task.resume()) {}
+
+	EXPECT_TRUE(task.done());
+	EXPECT_EQ(task.get(), bst_empty.cend());
+}
+
+TEST(binary_search_tree__methods, async_find__filled_bst) {
+	for (size_type i = 0; i < filled_inorder_matcher.size(); i++) {
+		binary_search_tree::find_task task = bst_filled.async_find(filled_inorder_matcher[i]);
+
+		while (task.resume()) {}
+
+		bst_cit = task.get();
+		EXPECT_NE(bst_cit, bst_filled.cend());
+		EXPECT_EQ(*bst_cit, filled_inorder_matcher[i]);
+	}
+}
+
+TEST(binary_search_tree__methods, async_find__non_existant_value) {
+	binary_search_tree::find_task task = bst_filled.async_find(query_value);
+
+	while (task.resume()) {}
+
+	EXPECT_EQ(task.get(), bst_filled.cend());
+}
+
+TEST(binary_search_tree__methods, async_find__suspends_per_level) {
+	// 1 is the deepest node of the filled BST (8 levels below the root)
+	binary_search_tree::find_task task = bst_filled.async_find(1);
+	size_type suspensions = 0;
+
+	while (task.resume()) {
+		suspensions++;
+	}
+
+	EXPECT_EQ(suspensions, 8);
+	EXPECT_EQ(*task.get(), 1);
+}
+
+TEST(binary_search_tree__methods, async_find__awaited) {
+	for (size_type i = 0; i < filled_inorder_matcher.size(); i++) {
+		bst_cit = bst_filled.cend();
+		await_find(bst_filled, filled_inorder_matcher[i], bst_cit);
+
+		EXPECT_NE(bst_cit, bst_filled.cend());
+		EXPECT_EQ(*bst_cit, filled_inorder_matcher[i]);
+	}
+
+	await_find(bst_filled, query_value, bst_cit);
+	EXPECT_EQ(bst_cit, bst_filled.cend());
+}
+
+TEST(binary_search_tree__methods, interleaved_find__empty_bst) {
+	std::vector<value_type> keys = {1, 2, 3};
+	std::vector<const_iterator> results(keys.size());
+
+	std::vector<const_iterator>::iterator last = bst_empty.interleaved_find(
+		keys.begin(), keys.end(), results.begin()
+	);
+
+	EXPECT_EQ(last, results.end());
+	for (const_iterator result : results) {
+		EXPECT_EQ(result, bst_empty.cend());
+	}
+}
+
+TEST(binary_search_tree__methods, interleaved_find__filled_bst) {
+	std::vector<value_type> keys(filled_inorder_matcher.rbegin(), filled_inorder_matcher.rend());
+	keys.push_back(query_value);
+
+	for (size_type group_size : {0, 1, 3, 8, 64}) {
+		std::vector<const_iterator> results(keys.size());
+
+		std::vector<const_iterator>::iterator last = bst_filled.interleaved_find(
+			keys.begin(), keys.end(), results.begin(), group_size
+		);
+
+		EXPECT_EQ(last, results.end());
+		for (size_type i = 0; i < keys.size() - 1; i++) {
+			EXPECT_NE(results[i], bst_filled.cend());
+			EXPECT_EQ(*results[i], keys[i]);
+		}
+		EXPECT_EQ(results.back(), bst_filled.cend());
+	}
+}
+
 TEST(binary_search_tree__methods, contains__empty_bst) {
 	EXPECT_FALSE(bst_empty.contains(single_matcher[0]));
 }
@@ -6008,6 +7060,146 @@ TEST(binary_search_tree__methods, contains__filled_bst) {
 	}
 }
 
+TEST(binary_search_tree__methods, hot_cache__hits_and_stats) {
+	binary_search_tree bst = filled_init;
+
+	// Without a cache nothing is counted
+	EXPECT_TRUE(bst.contains(37));
+	EXPECT_EQ(bst.hot_cache_stats().lookups, 0);
+
+	bst.enable_hot_cache(64);
+	for (size_type i = 0; i < 10; i++) {
+		EXPECT_EQ(*bst.find(37), 37);
+	}
+	EXPECT_FALSE(bst.contains(1000));
+	EXPECT_FALSE(bst.contains(1000));
+
+	// The first lookup of 37 fills its slot, and misses are never cached
+	adt::bst_cache_stats stats = bst.hot_cache_stats();
+	EXPECT_EQ(stats.lookups, 12);
+	EXPECT_EQ(stats.hits, 9);
+	EXPECT_DOUBLE_EQ(stats.hit_rate(), 0.75);
+
+	bst.disable_hot_cache();
+	EXPECT_EQ(bst.hot_cache_stats().hit_rate(), 0.0);
+	EXPECT_TRUE(bst.contains(37));
+}
+
+TEST(binary_search_tree__methods, hot_cache__invalidation) {
+	binary_search_tree bst = filled_init;
+	binary_search_tree other = {1, 2, 3};
+	bst.enable_hot_cache(16);
+
+	// Cache every value, then remove them in every way a node can leave the BST
+	auto warm = [&bst] {
+		for (value_type value : filled_init) {
+			static_cast<void>(bst.find(value));
+		}
+	};
+
+	warm();
+	bst.erase(bst.find(37));
+	EXPECT_FALSE(bst.contains(37));
+	bst.insert(37);
+	EXPECT_EQ(*bst.find(37), 37);
+
+	warm();
+	EXPECT_EQ(bst.pop_min(), 1);
+	EXPECT_EQ(bst.pop_max(), 101);
+	EXPECT_FALSE(bst.contains(1));
+	EXPECT_FALSE(bst.contains(101));
+
+	warm();
+	node_type node = bst.extract(bst.find(50));
+	EXPECT_FALSE(bst.contains(50));
+	bst.insert(std::move(node));
+
+	warm();
+	bst.erase(bst.find(30), bst.find(40));
+	EXPECT_FALSE(bst.contains(33));
+	EXPECT_TRUE(bst.contains(40));
+
+	warm();
+	bst.erase_if([](value_type value) { return value % 2 == 0; });
+	EXPECT_FALSE(bst.contains(50));
+	EXPECT_TRUE(bst.contains(45));
+
+	warm();
+	bst.swap(other);
+	EXPECT_FALSE(bst.contains(45));
+	EXPECT_TRUE(bst.contains(2));
+
+	bst = filled_init;
+	warm();
+	bst = other;
+	EXPECT_FALSE(bst.contains(60));
+	EXPECT_EQ(bst, other);
+
+	bst = filled_init;
+	warm();
+	bst.clear();
+	EXPECT_FALSE(bst.contains(60));
+	EXPECT_GT(bst.hot_cache_stats().hits, 0);
+}
+
+TEST(binary_search_tree__methods, hot_cache__randomized_against_std_set) {
+	std::mt19937 rng(12345);
+	std::set<value_type> set;
+	binary_search_tree bst;
+
+	// A cache far smaller than the key range keeps slots colliding and being evicted
+	bst.enable_hot_cache(8);
+	for (size_type i = 0; i < 20000; i++) {
+		value_type value = static_cast<value_type>(rng() % 256);
+		switch (rng() % 3) {
+			case 0:
+				ASSERT_EQ(bst.insert(value).second, set.insert(value).second);
+				break;
+			case 1:
+				ASSERT_EQ(bst.contains(value), set.contains(value));
+				break;
+			default:
+				if (iterator it = bst.find(value); it != bst.end()) {
+					ASSERT_EQ(*it, value);
+					bst.erase(it);
+				}
+				set.erase(value);
+		}
+	}
+
+	EXPECT_TRUE(std::equal(bst.cbegin(), bst.cend(), set.begin(), set.end()));
+	EXPECT_GT(bst.hot_cache_stats().hits, 0);
+}
+
+TEST(binary_search_tree__methods, hot_cache__concurrent_const_lookups) {
+	std::vector<value_type> values(4096);
+	std::iota(values.begin(), values.end(), 0);
+	binary_search_tree bst(adt::bst_sorted_unique, values.begin(), values.end());
+	bst.enable_hot_cache(64);
+	const binary_search_tree& cbst = bst;
+
+	// Readers share the cache through const lookups alone, each counting the values it finds
+	std::vector<std::thread> readers;
+	std::vector<size_type> found(4, 0);
+	for (size_type t = 0; t < 4; t++) {
+		readers.emplace_back([&cbst, &found, t] {
+			for (value_type i = 0; i < 20000; i++) {
+				value_type value = (i * 7 + static_cast<value_type>(t)) % 5000;
+				found[t] += (cbst.contains(value) && *cbst.find(value) == value) ? 1 : 0;
+			}
+		});
+	}
+	for (std::thread& reader : readers) {
+		reader.join();
+	}
+
+	for (size_type t = 0; t < 4; t++) {
+		EXPECT_EQ(found[t], 16384);
+	}
+	EXPECT_EQ(cbst.hot_cache_stats().lookups, 4 * 20000 + 4 * 16384);
+	EXPECT_GT(cbst.hot_cache_stats().hits, 0);
+}
+
 TEST(binary_search_tree__methods, equal_range__iterator__empty_bst) {
 	std::pair<iterator, iterator> range = bst_empty.equal_range(single_matcher[0]);
 	bst_it = bst_empty.begin();
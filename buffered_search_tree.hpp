@@ -0,0 +1,261 @@
+#ifndef BUFFERED_SEARCH_TREE_HPP
+#define BUFFERED_SEARCH_TREE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <initializer_list>
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "binary_search_tree.hpp"
+
+
+namespace adt {
+
+    // A BST behind a small sorted write buffer. Inserts and erases (as tombstones) land in the buffer without
+    // touching the BST; a full buffer is merged into the BST in one join-based pass, and lookups check the buffer
+    // before the BST
+    template<class T, class Allocator = std::allocator<T>>
+    class buffered_search_tree : protected binary_search_tree<T, Allocator> {
+    public:
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        using tree_type = binary_search_tree<T, Allocator>;
+
+        using value_type = typename tree_type::value_type;
+
+        using allocator_type = typename tree_type::allocator_type;
+
+        using size_type = typename tree_type::size_type;
+
+        using const_reference = typename tree_type::const_reference;
+
+    protected:
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        using _Node = typename tree_type::_Node;
+
+        struct _Entry {
+            value_type value;
+
+            // A tombstone: `value` is to be removed from the BST
+            bool erased;
+        };
+
+        /* ------------------------------------------------Fields--------------------------------------------------- */
+        static constexpr size_type default_capacity = 1024;
+
+        // Pending writes, sorted by value, with at most one entry per value
+        std::vector<_Entry> buffer;
+
+        size_type capacity;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        typename std::vector<_Entry>::iterator _find_entry(const_reference value) noexcept {
+            return std::lower_bound(this->buffer.begin(), this->buffer.end(), value,
+                                    [](const _Entry& entry, const_reference value) { return entry.value < value; });
+        }
+
+        typename std::vector<_Entry>::const_iterator _find_entry(const_reference value) const noexcept {
+            return std::lower_bound(this->buffer.begin(), this->buffer.end(), value,
+                                    [](const _Entry& entry, const_reference value) { return entry.value < value; });
+        }
+
+        void _write(const_reference value, bool erased) {
+            // A later write to the same value replaces the earlier one
+            auto it = this->_find_entry(value);
+            if (it != this->buffer.end() && !(value < it->value)) {
+                it->erased = erased;
+            } else {
+                this->buffer.insert(it, _Entry{value, erased});
+            }
+
+            if (this->buffer.size() >= this->capacity) {
+                this->flush();
+            }
+        }
+
+        void _construct_fresh(std::vector<_Node*>& fresh) {
+            // Create a node for every value the BST does not hold yet, before the BST is cut up, so that a throwing
+            // allocation or copy leaves it as it was
+            fresh.assign(this->buffer.size(), nullptr);
+            try {
+                for (size_type i = 0; i < this->buffer.size(); i++) {
+                    const _Entry& entry = this->buffer[i];
+                    if (!entry.erased && tree_type::_find_target(entry.value, this->root) == nullptr) {
+                        fresh[i] = this->_construct_node(entry.value, nullptr, nullptr, nullptr);
+                    }
+                }
+            } catch (...) {
+                for (_Node* node : fresh) {
+                    if (node != nullptr) {
+                        this->_destroy_node(node);
+                    }
+                }
+                throw;
+            }
+        }
+
+        _Node* _union(_Node* tree, const _Entry* entries, _Node* const* fresh, size_type count) noexcept {
+            if (count == 0) {
+                return tree;
+            }
+
+            // Split the BST around the middle entry; a node equal to it becomes the minimum of the greater part
+            size_type mid = count / 2;
+            const _Entry& entry = entries[mid];
+            auto [less, greater] = tree_type::_split(tree, entry.value);
+
+            _Node* match = tree_type::_find_min(greater);
+            if (match != nullptr && !(entry.value < match->value)) {
+                // Unlink the match, which has no left child
+                if (match == greater) {
+                    greater = match->right;
+                } else {
+                    match->parent->left = match->right;
+                }
+                if (match->right != nullptr) {
+                    match->right->parent = match->parent;
+                }
+            } else {
+                match = nullptr;
+            }
+
+            // Merge each half of the buffer into the matching half of the BST
+            _Node* left = this->_union(less, entries, fresh, mid);
+            _Node* right = this->_union(greater, entries + mid + 1, fresh + mid + 1, count - mid - 1);
+
+            _Node* root;
+            if (!entry.erased) {
+                // Reuse the matching node, or take the one made for the new value
+                if (match != nullptr) {
+                    root = match;
+                } else {
+                    root = fresh[mid];
+                    this->sz++;
+                }
+            } else {
+                if (match != nullptr) {
+                    match->parent = match->left = match->right = nullptr;
+                    this->_destroy_node(match);
+                    this->sz--;
+                }
+
+                if (left == nullptr || right == nullptr) {
+                    _Node* only = (left != nullptr) ? left : right;
+                    if (only != nullptr) {
+                        only->parent = nullptr;
+                    }
+
+                    return only;
+                }
+
+                // Join the two halves under the left half's maximum node
+                root = tree_type::_find_max(left);
+                if (root == left) {
+                    left = root->left;
+                } else {
+                    root->parent->right = root->left;
+                    if (root->left != nullptr) {
+                        root->left->parent = root->parent;
+                    }
+                }
+            }
+
+            root->parent = nullptr;
+            root->left = left;
+            root->right = right;
+            if (left != nullptr) {
+                left->parent = root;
+            }
+            if (right != nullptr) {
+                right->parent = root;
+            }
+
+            return root;
+        }
+
+    public:
+        /* ---------------------------------------------Constructors------------------------------------------------ */
+        explicit buffered_search_tree(size_type capacity = default_capacity) noexcept
+            : tree_type(), capacity(std::max<size_type>(capacity, 1)) {}
+
+        explicit buffered_search_tree(tree_type&& tree, size_type capacity = default_capacity) noexcept
+            : tree_type(std::move(tree)), capacity(std::max<size_type>(capacity, 1)) {}
+
+        buffered_search_tree(std::initializer_list<value_type> values, size_type capacity = default_capacity)
+            : buffered_search_tree(capacity) {
+            for (const_reference value : values) {
+                this->insert(value);
+            }
+        }
+
+        buffered_search_tree(const buffered_search_tree& other) = default;
+
+        buffered_search_tree(buffered_search_tree&& other) noexcept = default;
+
+        /* -----------------------------------------------Destructor------------------------------------------------ */
+        virtual ~buffered_search_tree() noexcept override = default;
+
+        /* ------------------------------------------Overloaded Operators------------------------------------------- */
+        buffered_search_tree& operator=(const buffered_search_tree& rhs) = default;
+
+        buffered_search_tree& operator=(buffered_search_tree&& rhs) noexcept = default;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        [[nodiscard]] size_type buffer_capacity() const noexcept { return this->capacity; }
+
+        [[nodiscard]] size_type buffered() const noexcept { return this->buffer.size(); }
+
+        [[nodiscard]] virtual bool contains(const_reference value) const noexcept override {
+            // The buffer holds the most recent write to `value`, if there is one
+            auto it = this->_find_entry(value);
+            if (it != this->buffer.end() && !(value < it->value)) {
+                return !it->erased;
+            }
+
+            return tree_type::_find_target(value, this->root) != nullptr;
+        }
+
+        [[nodiscard]] size_type count(const_reference value) const noexcept { return this->contains(value) ? 1 : 0; }
+
+        void insert(const_reference value) { this->_write(value, false); }
+
+        void erase(const_reference value) { this->_write(value, true); }
+
+        void flush() {
+            if (this->buffer.empty()) {
+                return;
+            }
+
+            std::vector<_Node*> fresh;
+            this->_construct_fresh(fresh);
+
+            // Merge every pending write in one pass, which can no longer fail, then refresh the cached extremes
+            this->root = this->_union(this->root, this->buffer.data(), fresh.data(), this->buffer.size());
+            this->min_node = tree_type::_find_min(this->root);
+            this->max_node = tree_type::_find_max(this->root);
+
+            this->buffer.clear();
+        }
+
+        [[nodiscard]] size_type size() {
+            this->flush();
+            return tree_type::size();
+        }
+
+        [[nodiscard]] bool empty() { return this->size() == 0; }
+
+        [[nodiscard]] const tree_type& tree() {
+            this->flush();
+            return *this;
+        }
+
+        virtual void clear() noexcept override {
+            this->buffer.clear();
+            tree_type::clear();
+        }
+    };
+} // adt
+
+
+#endif // BUFFERED_SEARCH_TREE_HPP
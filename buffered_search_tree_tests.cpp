@@ -0,0 +1,193 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#include "buffered_search_tree.hpp"
+
+/* --------------------------------------------Definitions--------------------------------------------------- */
+using value_type = int;
+
+using size_type = std::size_t;
+
+using binary_search_tree = adt::binary_search_tree<value_type>;
+
+using buffered_search_tree = adt::buffered_search_tree<value_type>;
+
+// Throws from its copy constructor once a budget of copies runs out
+struct throwing_value {
+	static inline long copies_left = -1;
+
+	value_type value;
+
+	throwing_value(value_type value) noexcept : value(value) {}
+
+	throwing_value(const throwing_value& other) : value(other.value) {
+		if (copies_left-- == 0) {
+			throw std::runtime_error("throwing_value: copy budget exhausted");
+		}
+	}
+
+	throwing_value& operator=(const throwing_value& rhs) noexcept = default;
+
+	friend bool operator==(const throwing_value& lhs, const throwing_value& rhs) noexcept = default;
+
+	friend auto operator<=>(const throwing_value& lhs, const throwing_value& rhs) noexcept = default;
+};
+
+/* ---------------------------------------------Variables---------------------------------------------------- */
+constexpr std::initializer_list<value_type> buffered_init = {50, 30, 70, 20, 40, 60, 80, 10, 25, 35, 45, 55, 65};
+
+constexpr std::initializer_list<value_type> buffered_matcher = {10, 20, 25, 30, 35, 40, 45, 50, 55, 60, 65, 70, 80};
+
+/* --------------------------------------Buffered Search Tree Tests------------------------------------------ */
+TEST(buffered_search_tree__constructors, default_constructor) {
+	buffered_search_tree bst;
+
+	EXPECT_EQ(bst.buffer_capacity(), 1024);
+	EXPECT_EQ(bst.buffered(), 0);
+	EXPECT_TRUE(bst.empty());
+	EXPECT_FALSE(bst.contains(101));
+}
+
+TEST(buffered_search_tree__constructors, initializer_list_constructor) {
+	buffered_search_tree bst = buffered_init;
+
+	EXPECT_EQ(bst.buffered(), buffered_init.size());
+	EXPECT_EQ(bst.size(), buffered_matcher.size());
+	EXPECT_EQ(bst.buffered(), 0);
+
+	const binary_search_tree& tree = bst.tree();
+	EXPECT_TRUE(std::equal(tree.cbegin(), tree.cend(), buffered_matcher.begin(), buffered_matcher.end()));
+}
+
+TEST(buffered_search_tree__methods, insert_and_erase__before_flush) {
+	buffered_search_tree bst{binary_search_tree(buffered_init)};
+
+	bst.insert(42);
+	bst.erase(50);
+	bst.erase(11);
+
+	// Lookups see the buffered writes before they reach the BST
+	EXPECT_EQ(bst.buffered(), 3);
+	EXPECT_TRUE(bst.contains(42));
+	EXPECT_FALSE(bst.contains(50));
+	EXPECT_FALSE(bst.contains(11));
+	EXPECT_TRUE(bst.contains(45));
+
+	// The latest write to a value wins
+	bst.insert(50);
+	bst.erase(42);
+	EXPECT_EQ(bst.buffered(), 3);
+	EXPECT_TRUE(bst.contains(50));
+	EXPECT_FALSE(bst.contains(42));
+}
+
+TEST(buffered_search_tree__methods, flush__applies_inserts_and_tombstones) {
+	buffered_search_tree bst{binary_search_tree(buffered_init)};
+
+	bst.insert(5);
+	bst.insert(42);
+	bst.insert(90);
+	bst.insert(50);
+	bst.erase(10);
+	bst.erase(30);
+	bst.erase(80);
+	bst.erase(11);
+	bst.flush();
+
+	std::vector<value_type> matcher = {5, 20, 25, 35, 40, 42, 45, 50, 55, 60, 65, 70, 90};
+	const binary_search_tree& tree = bst.tree();
+
+	EXPECT_EQ(bst.buffered(), 0);
+	EXPECT_EQ(tree.size(), matcher.size());
+	EXPECT_TRUE(std::equal(tree.cbegin(), tree.cend(), matcher.begin(), matcher.end()));
+	EXPECT_EQ(tree.peek_min(), 5);
+	EXPECT_EQ(tree.peek_max(), 90);
+}
+
+TEST(buffered_search_tree__methods, flush__throwing_copy_leaves_tree_intact) {
+	adt::binary_search_tree<throwing_value> tree;
+	std::set<value_type> matcher;
+	for (value_type value = 0; value < 200; value += 2) {
+		tree.insert(value);
+		matcher.insert(value);
+	}
+
+	adt::buffered_search_tree<throwing_value> bst(std::move(tree), 1000);
+	for (value_type value = 1; value < 100; value += 4) {
+		bst.insert(value);
+		matcher.insert(value);
+	}
+	for (value_type value = 0; value < 200; value += 10) {
+		bst.erase(value);
+		matcher.erase(value);
+	}
+
+	// Fail on the first new node and part way through; nothing is cut up or leaked, and the writes stay pending
+	for (long budget : {0L, 10L}) {
+		throwing_value::copies_left = budget;
+		EXPECT_THROW(bst.flush(), std::runtime_error);
+		throwing_value::copies_left = -1;
+		EXPECT_EQ(bst.buffered(), 45);
+	}
+
+	const adt::binary_search_tree<throwing_value>& flushed = bst.tree();
+	EXPECT_EQ(bst.buffered(), 0);
+	EXPECT_EQ(flushed.size(), matcher.size());
+	EXPECT_TRUE(std::equal(flushed.cbegin(), flushed.cend(), matcher.begin(), matcher.end(),
+						   [](const throwing_value& lhs, value_type rhs) { return lhs.value == rhs; }));
+	EXPECT_EQ(flushed.peek_min().value, *matcher.begin());
+	EXPECT_EQ(flushed.peek_max().value, *matcher.rbegin());
+}
+
+TEST(buffered_search_tree__methods, flush__at_capacity) {
+	buffered_search_tree bst(4);
+
+	for (value_type value = 0; value < 10; value++) {
+		bst.insert(value);
+	}
+
+	EXPECT_EQ(bst.buffered(), 2);
+	EXPECT_EQ(bst.size(), 10);
+}
+
+TEST(buffered_search_tree__methods, randomized_against_std_set) {
+	buffered_search_tree bst(64);
+	std::set<value_type> set;
+	std::mt19937 rng(12345);
+
+	for (size_type i = 0; i < 20000; i++) {
+		value_type value = static_cast<value_type>(rng() % 2000);
+		if (rng() % 3 == 0) {
+			bst.erase(value);
+			set.erase(value);
+		} else {
+			bst.insert(value);
+			set.insert(value);
+		}
+
+		ASSERT_EQ(bst.contains(value), set.contains(value)) << i;
+	}
+
+	const binary_search_tree& tree = bst.tree();
+	EXPECT_EQ(tree.size(), set.size());
+	EXPECT_TRUE(std::equal(tree.cbegin(), tree.cend(), set.begin(), set.end()));
+	EXPECT_EQ(tree.peek_min(), *set.begin());
+	EXPECT_EQ(tree.peek_max(), *set.rbegin());
+}
+
+TEST(buffered_search_tree__methods, clear) {
+	buffered_search_tree bst{binary_search_tree(buffered_init)};
+	bst.insert(42);
+
+	bst.clear();
+
+	EXPECT_EQ(bst.buffered(), 0);
+	EXPECT_TRUE(bst.empty());
+	EXPECT_FALSE(bst.contains(42));
+	EXPECT_FALSE(bst.contains(50));
+}
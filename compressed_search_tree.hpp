@@ -0,0 +1,266 @@
+#ifndef COMPRESSED_SEARCH_TREE_HPP
+#define COMPRESSED_SEARCH_TREE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <concepts>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "binary_search_tree.hpp"
+
+
+namespace adt {
+
+    // An immutable ordered set of integers stored as delta-varint blocks. Each block of up to `BlockSize` values
+    // keeps its first value uncompressed in a small block index and the gaps to the rest as LEB128 varints, so
+    // dense keys take one or two bytes each. Lookups binary search the block index and decode one block
+    template<class T, std::size_t BlockSize = 128>
+        // bool is integral, but it has no unsigned counterpart to hold the gaps between values
+        requires(std::integral<T> && !std::same_as<std::remove_cv_t<T>, bool>)
+    class compressed_search_tree {
+    public:
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        using value_type = T;
+
+        using size_type = std::size_t;
+
+        using difference_type = std::ptrdiff_t;
+
+        using const_reference = const value_type&;
+
+        static_assert(BlockSize > 0, "adt::compressed_search_tree error: blocks must hold at least one value");
+
+    protected:
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        using _Unsigned = std::make_unsigned_t<value_type>;
+
+        /* ------------------------------------------------Fields--------------------------------------------------- */
+        // The first value of every block, which is all a lookup searches before it decodes a block
+        std::vector<value_type> block_first;
+
+        // Where every block's varints start in `bytes`
+        std::vector<size_type> block_offset;
+
+        std::vector<std::uint8_t> bytes;
+
+        size_type sz = 0;
+
+        value_type last_value{};
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        size_type _block_end(size_type block) const noexcept {
+            return (block + 1 < this->block_offset.size()) ? this->block_offset[block + 1] : this->bytes.size();
+        }
+
+        void _append(value_type value) {
+            if (this->sz % BlockSize == 0) {
+                this->block_first.push_back(value);
+                this->block_offset.push_back(this->bytes.size());
+            } else {
+                // Values are strictly increasing, so the gap is positive and fits in the unsigned type
+                _Unsigned gap = static_cast<_Unsigned>(value) - static_cast<_Unsigned>(this->last_value);
+                while (gap >= 0x80) {
+                    this->bytes.push_back(static_cast<std::uint8_t>(gap | 0x80));
+                    gap >>= 7;
+                }
+                this->bytes.push_back(static_cast<std::uint8_t>(gap));
+            }
+
+            this->last_value = value;
+            this->sz++;
+        }
+
+        template<std::input_iterator InputIt>
+        void _build(InputIt first, InputIt last) {
+            for (; first != last; ++first) {
+                this->_append(*first);
+            }
+
+            // The set never grows again, so give back the slack
+            this->block_first.shrink_to_fit();
+            this->block_offset.shrink_to_fit();
+            this->bytes.shrink_to_fit();
+        }
+
+    public:
+        /* ---------------------------------------------Const Iterator---------------------------------------------- */
+        class const_iterator {
+        private:
+            /* --------------------------------------------Friends-------------------------------------------------- */
+            friend class compressed_search_tree;
+
+        public:
+            /* ------------------------------------------Definitions----------------------------------------------- */
+            using iterator_category = std::forward_iterator_tag;
+
+            using value_type = compressed_search_tree::value_type;
+
+            using difference_type = compressed_search_tree::difference_type;
+
+            using pointer = const value_type*;
+
+            using reference = const value_type&;
+
+        protected:
+            /* ---------------------------------------------Fields-------------------------------------------------- */
+            const compressed_search_tree* tree = nullptr;
+
+            // A past-the-end iterator sits one block past the last one
+            size_type block = 0;
+
+            // Where the next gap in the block starts
+            size_type offset = 0;
+
+            value_type value{};
+
+            /* ------------------------------------------Constructors----------------------------------------------- */
+            const_iterator(const compressed_search_tree* tree, size_type block) noexcept : tree(tree), block(block) {
+                if (this->block < this->tree->block_first.size()) {
+                    this->offset = this->tree->block_offset[this->block];
+                    this->value = this->tree->block_first[this->block];
+                }
+            }
+
+        public:
+            /* ------------------------------------------Constructors----------------------------------------------- */
+            const_iterator() noexcept = default;
+
+            /* ---------------------------------------Overloaded Operators------------------------------------------ */
+            [[nodiscard]] reference operator*() const noexcept { return this->value; }
+
+            [[nodiscard]] pointer operator->() const noexcept { return &this->value; }
+
+            const_iterator& operator++() noexcept {
+                // Decode the next gap in this block, or move on to the first value of the next one
+                if (this->offset < this->tree->_block_end(this->block)) {
+                    _Unsigned gap = 0;
+                    unsigned int shift = 0;
+                    std::uint8_t byte;
+                    do {
+                        byte = this->tree->bytes[this->offset++];
+                        gap |= static_cast<_Unsigned>(byte & 0x7f) << shift;
+                        shift += 7;
+                    } while (byte & 0x80);
+
+                    this->value = static_cast<value_type>(static_cast<_Unsigned>(this->value) + gap);
+                } else {
+                    *this = const_iterator(this->tree, this->block + 1);
+                }
+
+                return *this;
+            }
+
+            const_iterator operator++(int) noexcept {
+                const_iterator temp = *this;
+                ++*this;
+                return temp;
+            }
+
+            [[nodiscard]] bool operator==(const const_iterator& rhs) const noexcept {
+                return this->block == rhs.block && this->offset == rhs.offset;
+            }
+        };
+
+        /* ---------------------------------------------Constructors------------------------------------------------ */
+        compressed_search_tree() noexcept = default;
+
+        // `first` to `last` must be sorted and hold no duplicates
+        template<std::input_iterator InputIt>
+        compressed_search_tree(bst_sorted_unique_t, InputIt first, InputIt last) {
+            this->_build(first, last);
+        }
+
+        template<class Allocator>
+        explicit compressed_search_tree(const binary_search_tree<T, Allocator>& tree) {
+            this->_build(tree.cbegin(), tree.cend());
+        }
+
+        compressed_search_tree(std::initializer_list<value_type> values) {
+            std::vector<value_type> sorted(values);
+            std::sort(sorted.begin(), sorted.end());
+            sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+
+            this->_build(sorted.begin(), sorted.end());
+        }
+
+        compressed_search_tree(const compressed_search_tree& other) = default;
+
+        compressed_search_tree(compressed_search_tree&& other) noexcept = default;
+
+        /* -----------------------------------------------Destructor------------------------------------------------ */
+        ~compressed_search_tree() noexcept = default;
+
+        /* ------------------------------------------Overloaded Operators------------------------------------------- */
+        compressed_search_tree& operator=(const compressed_search_tree& rhs) = default;
+
+        compressed_search_tree& operator=(compressed_search_tree&& rhs) noexcept = default;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        [[nodiscard]] const_iterator begin() const noexcept { return const_iterator(this, 0); }
+
+        [[nodiscard]] const_iterator end() const noexcept { return const_iterator(this, this->block_first.size()); }
+
+        [[nodiscard]] const_iterator cbegin() const noexcept { return this->begin(); }
+
+        [[nodiscard]] const_iterator cend() const noexcept { return this->end(); }
+
+        [[nodiscard]] size_type size() const noexcept { return this->sz; }
+
+        [[nodiscard]] bool empty() const noexcept { return this->sz == 0; }
+
+        // Bytes held by the blocks and the block index
+        [[nodiscard]] size_type memory_usage() const noexcept {
+            return this->block_first.capacity() * sizeof(value_type) +
+                   this->block_offset.capacity() * sizeof(size_type) + this->bytes.capacity();
+        }
+
+        [[nodiscard]] const_iterator lower_bound(const_reference value) const noexcept {
+            // Start from the last block whose first value is not greater than `value`
+            auto it = std::upper_bound(this->block_first.begin(), this->block_first.end(), value);
+            if (it == this->block_first.begin()) {
+                return this->begin();
+            }
+
+            // Decoding past the end of the block lands on the next block's first value, which is greater
+            const_iterator cit(this, static_cast<size_type>(it - this->block_first.begin()) - 1);
+            size_type block = cit.block;
+            while (cit.block == block && *cit < value) {
+                ++cit;
+            }
+
+            return cit;
+        }
+
+        [[nodiscard]] const_iterator upper_bound(const_reference value) const noexcept {
+            const_iterator cit = this->lower_bound(value);
+            if (cit != this->end() && !(value < *cit)) {
+                ++cit;
+            }
+
+            return cit;
+        }
+
+        [[nodiscard]] const_iterator find(const_reference value) const noexcept {
+            const_iterator cit = this->lower_bound(value);
+            return (cit != this->end() && !(value < *cit)) ? cit : this->end();
+        }
+
+        [[nodiscard]] bool contains(const_reference value) const noexcept { return this->find(value) != this->end(); }
+
+        [[nodiscard]] size_type count(const_reference value) const noexcept { return this->contains(value) ? 1 : 0; }
+
+        template<class Allocator = std::allocator<T>>
+        [[nodiscard]] binary_search_tree<T, Allocator> decompress() const {
+            // Decode into a buffer, then build a balanced BST from it in O(n)
+            std::vector<value_type> values(this->begin(), this->end());
+            return binary_search_tree<T, Allocator>(bst_sorted_unique, values.begin(), values.end());
+        }
+    };
+} // adt
+
+
+#endif // COMPRESSED_SEARCH_TREE_HPP
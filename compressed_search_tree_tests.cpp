@@ -0,0 +1,128 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "compressed_search_tree.hpp"
+
+/* --------------------------------------------Definitions--------------------------------------------------- */
+using value_type = int;
+
+using size_type = std::size_t;
+
+using binary_search_tree = adt::binary_search_tree<value_type>;
+
+using compressed_search_tree = adt::compressed_search_tree<value_type, 4>;
+
+template<class T>
+concept compressible = requires { typename adt::compressed_search_tree<T>; };
+
+/* ---------------------------------------------Variables---------------------------------------------------- */
+constexpr std::initializer_list<value_type> compressed_init = {50, 30, 70, 20, 40, 60, 80, 10, 25, 35, 45, 55, 65};
+
+constexpr std::initializer_list<value_type> compressed_matcher = {10, 20, 25, 30, 35, 40, 45, 50, 55, 60, 65, 70, 80};
+
+/* -------------------------------------Compressed Search Tree Tests----------------------------------------- */
+TEST(compressed_search_tree__constructors, default_constructor) {
+	compressed_search_tree cst;
+
+	EXPECT_TRUE(cst.empty());
+	EXPECT_EQ(cst.begin(), cst.end());
+	EXPECT_EQ(cst.lower_bound(50), cst.end());
+	EXPECT_FALSE(cst.contains(50));
+	EXPECT_EQ(cst.memory_usage(), 0);
+}
+
+TEST(compressed_search_tree__constructors, bst_constructor) {
+	binary_search_tree bst = compressed_init;
+	compressed_search_tree cst(bst);
+
+	EXPECT_EQ(cst.size(), compressed_matcher.size());
+	EXPECT_TRUE(std::equal(cst.begin(), cst.end(), compressed_matcher.begin(), compressed_matcher.end()));
+
+	// Decompressing gives back an equal BST
+	binary_search_tree decompressed = cst.decompress();
+	EXPECT_TRUE(std::equal(decompressed.cbegin(), decompressed.cend(), bst.cbegin(), bst.cend()));
+}
+
+TEST(compressed_search_tree__constructors, initializer_list_constructor) {
+	compressed_search_tree cst = {5, 3, 5, 1, 3};
+
+	EXPECT_EQ(cst.size(), 3);
+	EXPECT_THAT(std::vector<value_type>(cst.begin(), cst.end()), ::testing::ElementsAre(1, 3, 5));
+}
+
+TEST(compressed_search_tree__methods, find_and_bounds) {
+	compressed_search_tree cst = compressed_init;
+
+	EXPECT_EQ(*cst.find(45), 45);
+	EXPECT_EQ(cst.find(46), cst.end());
+	EXPECT_EQ(cst.count(80), 1);
+
+	// Bounds that fall inside a block, on a block's first value, and past the last value
+	EXPECT_EQ(*cst.lower_bound(46), 50);
+	EXPECT_EQ(*cst.lower_bound(35), 35);
+	EXPECT_EQ(*cst.upper_bound(35), 40);
+	EXPECT_EQ(*cst.lower_bound(0), 10);
+	EXPECT_EQ(*cst.upper_bound(33), 35);
+	EXPECT_EQ(cst.lower_bound(81), cst.end());
+	EXPECT_EQ(cst.upper_bound(80), cst.end());
+
+	// Iteration picks up from a bound
+	EXPECT_THAT(std::vector<value_type>(cst.lower_bound(52), cst.end()), ::testing::ElementsAre(55, 60, 65, 70, 80));
+}
+
+TEST(compressed_search_tree__methods, extreme_values) {
+	adt::compressed_search_tree<std::int64_t> cst = {INT64_MIN, -1, 0, 1, INT64_MAX};
+
+	// Gaps that span the whole range still fit in the unsigned type
+	EXPECT_THAT(std::vector<std::int64_t>(cst.begin(), cst.end()),
+				::testing::ElementsAre(INT64_MIN, -1, 0, 1, INT64_MAX));
+	EXPECT_TRUE(cst.contains(INT64_MAX));
+	EXPECT_EQ(*cst.upper_bound(1), INT64_MAX);
+}
+
+TEST(compressed_search_tree__methods, value_type_constraints) {
+	// Any integral type but bool, which has no unsigned type to hold the gaps
+	EXPECT_FALSE(compressible<bool>);
+	EXPECT_FALSE(compressible<const bool>);
+	EXPECT_TRUE(compressible<char>);
+	EXPECT_TRUE(compressible<std::uint64_t>);
+	EXPECT_FALSE(compressible<double>);
+}
+
+TEST(compressed_search_tree__methods, randomized_against_std_set) {
+	std::mt19937 rng(12345);
+	std::set<value_type> set;
+
+	for (size_type i = 0; i < 5000; i++) {
+		set.insert(static_cast<value_type>(rng() % 20000) - 10000);
+	}
+	adt::compressed_search_tree<value_type> cst(adt::bst_sorted_unique, set.begin(), set.end());
+
+	ASSERT_EQ(cst.size(), set.size());
+	EXPECT_TRUE(std::equal(cst.begin(), cst.end(), set.begin(), set.end()));
+
+	for (value_type value = -10001; value <= 10001; value++) {
+		auto lower = set.lower_bound(value);
+		auto upper = set.upper_bound(value);
+		auto clower = cst.lower_bound(value);
+		auto cupper = cst.upper_bound(value);
+
+		ASSERT_EQ(cst.contains(value), set.contains(value)) << value;
+		ASSERT_EQ(clower == cst.end(), lower == set.end()) << value;
+		ASSERT_EQ(cupper == cst.end(), upper == set.end()) << value;
+		if (lower != set.end()) {
+			ASSERT_EQ(*clower, *lower) << value;
+		}
+		if (upper != set.end()) {
+			ASSERT_EQ(*cupper, *upper) << value;
+		}
+	}
+
+	// Gaps here are small, so each value takes about a byte rather than a whole node
+	EXPECT_LT(cst.memory_usage(), 2 * set.size());
+}
@@ -0,0 +1,346 @@
+#ifndef CONCURRENT_SEARCH_TREE_HPP
+#define CONCURRENT_SEARCH_TREE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <initializer_list>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "binary_search_tree.hpp"
+
+
+namespace adt {
+
+    template<class T, class Allocator = std::allocator<T>>
+    class concurrent_search_tree : protected binary_search_tree<T, Allocator> {
+    public:
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        using tree_type = binary_search_tree<T, Allocator>;
+
+        using value_type = typename tree_type::value_type;
+
+        using allocator_type = typename tree_type::allocator_type;
+
+        using size_type = typename tree_type::size_type;
+
+        using const_reference = typename tree_type::const_reference;
+
+    protected:
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        using _Node = typename tree_type::_Node;
+
+        // Readers announce themselves in one of these slots; each slot has its own cache line so that readers
+        // on different threads never write to the same line
+        struct alignas(64) reader_slot {
+            std::atomic<size_type> active = 0;
+        };
+
+        /* ------------------------------------------------Fields--------------------------------------------------- */
+        static constexpr size_type reader_slots = 64;
+
+        mutable reader_slot readers[reader_slots];
+
+        // Odd while a writer is modifying the BST
+        std::atomic<std::uint64_t> sequence;
+
+        mutable std::mutex writer_mutex;
+
+        // Nodes unlinked before the current grace period started, and nodes unlinked during it
+        std::vector<_Node*> retired;
+
+        std::vector<_Node*> deferred;
+
+        // Slots that have been observed without readers since the current grace period started
+        std::uint64_t quiescent;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        static size_type _slot_index() noexcept {
+            static std::atomic<size_type> next = 0;
+            thread_local size_type index = next.fetch_add(1, std::memory_order_relaxed) % reader_slots;
+            return index;
+        }
+
+        static const _Node* _load(_Node* const& link) noexcept {
+            return std::atomic_ref<_Node*>(const_cast<_Node*&>(link)).load(std::memory_order_acquire);
+        }
+
+        static void _store(_Node*& link, _Node* node) noexcept {
+            std::atomic_ref<_Node*>(link).store(node, std::memory_order_release);
+        }
+
+        template<class Function>
+        auto _read(Function&& function) const {
+            reader_slot& slot = this->readers[_slot_index()];
+
+            // Announce the reader before touching any node, so that writers never free a node it may reach
+            slot.active.fetch_add(1, std::memory_order_seq_cst);
+
+            while (true) {
+                std::uint64_t before = this->sequence.load(std::memory_order_acquire);
+
+                // Wait for the writer to finish
+                if (before & 1) {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                auto result = function();
+
+                // The result is only valid if no writer ran while it was being computed
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (this->sequence.load(std::memory_order_relaxed) == before) {
+                    slot.active.fetch_sub(1, std::memory_order_release);
+                    return result;
+                }
+            }
+        }
+
+        void _begin_write() noexcept {
+            this->sequence.store(this->sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+        }
+
+        void _end_write() noexcept {
+            this->sequence.store(this->sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+
+        const _Node* _find_concurrent(const_reference value) const noexcept {
+            // Every link is loaded atomically; a reader racing with an erase may take a stale path, which the
+            // sequence check in _read() catches
+            const _Node* curr = _load(this->root);
+            while (curr != nullptr && curr->value != value) {
+                curr = (value < curr->value) ? _load(curr->left) : _load(curr->right);
+            }
+
+            return curr;
+        }
+
+        void _replace_link(_Node* dst, _Node* src) noexcept {
+            // Point whatever pointed at `dst` (its parent or the root) at `src`, as _transplant() does, but with
+            // release stores so that readers loading the same links never race with a plain write
+            if (dst->parent == nullptr) {
+                _store(this->root, src);
+            } else if (dst == dst->parent->left) {
+                _store(dst->parent->left, src);
+            } else {
+                _store(dst->parent->right, src);
+            }
+
+            if (src != nullptr) {
+                _store(src->parent, dst->parent);
+            }
+        }
+
+        void _unlink(_Node* target) noexcept {
+            // Must run inside a write section. The replacement is detached and given the target's children
+            // before it is published in the target's place, so a reader on a stale path never meets a cycle
+            if (target->left == nullptr) {
+                this->_replace_link(target, target->right);
+            } else if (target->right == nullptr) {
+                this->_replace_link(target, target->left);
+            } else {
+                _Node* replacement = tree_type::_find_min(target->right);
+                if (replacement->parent != target) {
+                    this->_replace_link(replacement, replacement->right);
+                    _store(replacement->right, target->right);
+                    _store(replacement->right->parent, replacement);
+                }
+
+                _store(replacement->left, target->left);
+                _store(replacement->left->parent, replacement);
+                this->_replace_link(target, replacement);
+            }
+
+            // Readers never look at the extremes, so they are updated with plain stores
+            if (target == this->min_node) {
+                this->min_node = (target->right != nullptr) ? tree_type::_find_min(target->right) : target->parent;
+            }
+            if (target == this->max_node) {
+                this->max_node = (target->left != nullptr) ? tree_type::_find_max(target->left) : target->parent;
+            }
+            std::atomic_ref<size_type>(this->sz).store(this->sz - 1, std::memory_order_relaxed);
+        }
+
+        void _free(std::vector<_Node*>& nodes) noexcept {
+            for (_Node* node : nodes) {
+                // The links of an unlinked node are stale, so detach it before destroying it
+                node->parent = node->left = node->right = nullptr;
+                this->_destroy_node(node);
+            }
+
+            nodes.clear();
+        }
+
+        void _retire(_Node* node) {
+            // Start a grace period for the node, or queue it behind the one in progress
+            if (this->retired.empty()) {
+                this->retired.push_back(node);
+                this->quiescent = 0;
+            } else {
+                this->deferred.push_back(node);
+            }
+
+            // Order the unlinking stores before the slot loads below
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            // A slot that is seen empty has no reader left from before the grace period started
+            for (size_type i = 0; i < reader_slots; i++) {
+                if (this->readers[i].active.load(std::memory_order_acquire) == 0) {
+                    this->quiescent |= std::uint64_t(1) << i;
+                }
+            }
+
+            // Once every slot has been idle, free the retired nodes and start the deferred nodes' grace period
+            if (this->quiescent == ~std::uint64_t(0)) {
+                this->_free(this->retired);
+                std::swap(this->retired, this->deferred);
+                this->quiescent = 0;
+            }
+        }
+
+        void _synchronize() const noexcept {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            // Wait until every slot has been seen without readers at least once
+            for (size_type i = 0; i < reader_slots; i++) {
+                while (this->readers[i].active.load(std::memory_order_acquire) != 0) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+    public:
+        /* ---------------------------------------------Constructors------------------------------------------------ */
+        concurrent_search_tree() noexcept : tree_type(), sequence(0), quiescent(0) {}
+
+        explicit concurrent_search_tree(tree_type&& tree) noexcept
+            : tree_type(std::move(tree)), sequence(0), quiescent(0) {}
+
+        concurrent_search_tree(std::initializer_list<value_type> values) noexcept
+            : tree_type(values), sequence(0), quiescent(0) {}
+
+        concurrent_search_tree(const concurrent_search_tree& other) = delete;
+
+        concurrent_search_tree(concurrent_search_tree&& other) = delete;
+
+        /* -----------------------------------------------Destructor------------------------------------------------ */
+        virtual ~concurrent_search_tree() noexcept override {
+            // No reader can outlive the BST, so every retired node can be freed
+            this->_free(this->retired);
+            this->_free(this->deferred);
+        }
+
+        /* ------------------------------------------Overloaded Operators------------------------------------------- */
+        concurrent_search_tree& operator=(const concurrent_search_tree& rhs) = delete;
+
+        concurrent_search_tree& operator=(concurrent_search_tree&& rhs) = delete;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        [[nodiscard]] virtual bool contains(const_reference value) const noexcept override {
+            return this->_read([&] { return this->_find_concurrent(value) != nullptr; });
+        }
+
+        [[nodiscard]] size_type count(const_reference value) const noexcept { return this->contains(value) ? 1 : 0; }
+
+        [[nodiscard]] size_type size() const noexcept {
+            return this->_read([&] {
+                return std::atomic_ref<size_type>(const_cast<size_type&>(this->sz)).load(std::memory_order_relaxed);
+            });
+        }
+
+        [[nodiscard]] bool empty() const noexcept { return this->size() == 0; }
+
+        bool insert(const_reference value) {
+            std::lock_guard<std::mutex> lock(this->writer_mutex);
+
+            // Writers are serialized, so the BST can be searched without atomic loads
+            _Node* parent = nullptr;
+            for (_Node* curr = this->root; curr != nullptr;) {
+                if (curr->value == value) {
+                    return false;
+                }
+
+                parent = curr;
+                curr = (value < curr->value) ? curr->left : curr->right;
+            }
+
+            // Fully construct the node before a reader can reach it
+            _Node* node = this->_construct_node(value, parent, nullptr, nullptr);
+
+            this->_begin_write();
+
+            // Publish the node with a single release store
+            if (parent == nullptr) {
+                _store(this->root, node);
+            } else if (value < parent->value) {
+                _store(parent->left, node);
+            } else {
+                _store(parent->right, node);
+            }
+
+            if (this->min_node == nullptr || value < this->min_node->value) {
+                this->min_node = node;
+            }
+            if (this->max_node == nullptr || value > this->max_node->value) {
+                this->max_node = node;
+            }
+            std::atomic_ref<size_type>(this->sz).store(this->sz + 1, std::memory_order_relaxed);
+
+            this->_end_write();
+
+            return true;
+        }
+
+        size_type erase(const_reference value) {
+            std::lock_guard<std::mutex> lock(this->writer_mutex);
+
+            _Node* target = tree_type::_find_target(value, this->root);
+            if (target == nullptr) {
+                return 0;
+            }
+
+            // Unlink the node while readers are told to revalidate, but keep it alive until they are done
+            this->_begin_write();
+            this->_unlink(target);
+            this->_end_write();
+
+            this->_retire(target);
+
+            return 1;
+        }
+
+        virtual void clear() noexcept override {
+            std::lock_guard<std::mutex> lock(this->writer_mutex);
+
+            // Detach every node from the BST, then wait for readers that may still be inside it
+            _Node* detached = this->root;
+
+            this->_begin_write();
+            _store(this->root, nullptr);
+            this->min_node = this->max_node = nullptr;
+            std::atomic_ref<size_type>(this->sz).store(0, std::memory_order_relaxed);
+            this->_end_write();
+
+            this->_synchronize();
+
+            this->_destroy_subtree(detached);
+            this->_free(this->retired);
+            this->_free(this->deferred);
+        }
+
+        [[nodiscard]] tree_type snapshot() const {
+            std::lock_guard<std::mutex> lock(this->writer_mutex);
+
+            // Holding the writer lock keeps the BST stable for the duration of the copy
+            return tree_type(static_cast<const tree_type&>(*this));
+        }
+    };
+} // adt
+
+
+#endif // CONCURRENT_SEARCH_TREE_HPP
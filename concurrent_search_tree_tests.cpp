@@ -0,0 +1,155 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <random>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "concurrent_search_tree.hpp"
+
+/* --------------------------------------------Definitions--------------------------------------------------- */
+using value_type = int;
+
+using size_type = std::size_t;
+
+using concurrent_search_tree = adt::concurrent_search_tree<value_type>;
+
+/* ---------------------------------------------Variables---------------------------------------------------- */
+constexpr std::initializer_list<value_type> concurrent_init = {50, 30, 70, 20, 40, 60, 80, 10, 25, 35, 45, 55, 65};
+
+/* -------------------------------------Concurrent Search Tree Tests------------------------------------------ */
+TEST(concurrent_search_tree__constructors, default_constructor) {
+	concurrent_search_tree cst;
+
+	EXPECT_TRUE(cst.empty());
+	EXPECT_EQ(cst.size(), 0);
+	EXPECT_FALSE(cst.contains(101));
+}
+
+TEST(concurrent_search_tree__constructors, initializer_list_constructor) {
+	concurrent_search_tree cst = concurrent_init;
+
+	EXPECT_EQ(cst.size(), concurrent_init.size());
+	for (value_type value : concurrent_init) {
+		EXPECT_TRUE(cst.contains(value));
+	}
+	EXPECT_FALSE(cst.contains(101));
+}
+
+TEST(concurrent_search_tree__constructors, tree_constructor) {
+	adt::binary_search_tree<value_type> bst = concurrent_init;
+	concurrent_search_tree cst(std::move(bst));
+
+	EXPECT_EQ(cst.size(), concurrent_init.size());
+	EXPECT_TRUE(cst.contains(45));
+}
+
+TEST(concurrent_search_tree__methods, insert_and_erase) {
+	concurrent_search_tree cst = concurrent_init;
+
+	EXPECT_TRUE(cst.insert(42));
+	EXPECT_FALSE(cst.insert(42));
+	EXPECT_TRUE(cst.contains(42));
+	EXPECT_EQ(cst.size(), concurrent_init.size() + 1);
+
+	// Erase a leaf, a node with one child, and a node with two children
+	EXPECT_EQ(cst.erase(10), 1);
+	EXPECT_EQ(cst.erase(40), 1);
+	EXPECT_EQ(cst.erase(30), 1);
+	EXPECT_EQ(cst.erase(30), 0);
+
+	EXPECT_FALSE(cst.contains(10));
+	EXPECT_FALSE(cst.contains(30));
+	EXPECT_FALSE(cst.contains(40));
+	EXPECT_TRUE(cst.contains(42));
+	EXPECT_TRUE(cst.contains(35));
+	EXPECT_EQ(cst.size(), concurrent_init.size() - 2);
+}
+
+TEST(concurrent_search_tree__methods, erase__against_std_set) {
+	std::mt19937 rng(12345);
+	std::set<value_type> set;
+	concurrent_search_tree cst;
+
+	// Erasing extremes and two-child nodes repeatedly must keep the links, extremes and size consistent
+	for (size_type i = 0; i < 20000; i++) {
+		value_type value = static_cast<value_type>(rng() % 512);
+		if (rng() % 2 == 0) {
+			ASSERT_EQ(cst.insert(value), set.insert(value).second);
+		} else {
+			ASSERT_EQ(cst.erase(value), set.erase(value));
+		}
+	}
+
+	adt::binary_search_tree<value_type> bst = cst.snapshot();
+	EXPECT_EQ(cst.size(), set.size());
+	EXPECT_TRUE(std::equal(bst.cbegin(), bst.cend(), set.begin(), set.end()));
+}
+
+TEST(concurrent_search_tree__methods, snapshot) {
+	concurrent_search_tree cst = concurrent_init;
+	cst.erase(50);
+
+	adt::binary_search_tree<value_type> bst = cst.snapshot();
+
+	EXPECT_EQ(bst.size(), concurrent_init.size() - 1);
+	EXPECT_TRUE(std::is_sorted(bst.cbegin(), bst.cend()));
+	EXPECT_EQ(bst.find(50), bst.cend());
+}
+
+TEST(concurrent_search_tree__methods, clear) {
+	concurrent_search_tree cst = concurrent_init;
+	cst.erase(50);
+
+	cst.clear();
+
+	EXPECT_TRUE(cst.empty());
+	EXPECT_FALSE(cst.contains(30));
+
+	EXPECT_TRUE(cst.insert(30));
+	EXPECT_TRUE(cst.contains(30));
+}
+
+TEST(concurrent_search_tree__methods, readers_with_concurrent_writer) {
+	concurrent_search_tree cst;
+
+	// Even keys are never removed; odd keys are inserted and erased while readers run
+	for (value_type value = 0; value < 512; value += 2) {
+		cst.insert((value * 37) % 512);
+	}
+
+	std::atomic<bool> done = false;
+	std::atomic<size_type> missing = 0;
+	std::vector<std::thread> readers;
+
+	for (size_type r = 0; r < 4; r++) {
+		readers.emplace_back([&] {
+			while (!done.load()) {
+				for (value_type value = 0; value < 512; value += 2) {
+					if (!cst.contains((value * 37) % 512)) {
+						missing++;
+					}
+				}
+			}
+		});
+	}
+
+	for (size_type round = 0; round < 200; round++) {
+		for (value_type value = 1; value < 512; value += 2) {
+			cst.insert(value);
+		}
+		for (value_type value = 1; value < 512; value += 2) {
+			cst.erase(value);
+		}
+	}
+
+	done = true;
+	for (std::thread& reader : readers) {
+		reader.join();
+	}
+
+	EXPECT_EQ(missing.load(), 0);
+	EXPECT_EQ(cst.size(), 256);
+}
@@ -0,0 +1,367 @@
+#ifndef FROZEN_SEARCH_TREE_HPP
+#define FROZEN_SEARCH_TREE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "binary_search_tree.hpp"
+
+
+namespace adt {
+
+    // A read-only BST queried in place from a memory-mapped file. freeze() writes a BST as a balanced tree of
+    // fixed-size records in breadth-first order, linked by record indices rather than pointers, so the file needs
+    // no deserialization and every process that maps it shares the same page cache
+    template<class T>
+    class frozen_search_tree {
+    public:
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        using value_type = T;
+
+        using size_type = std::size_t;
+
+        using const_reference = const value_type&;
+
+        using const_pointer = const value_type*;
+
+        static_assert(std::is_trivially_copyable_v<value_type>,
+                      "adt::frozen_search_tree error: values must be trivially copyable to be mapped in place");
+
+    protected:
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        using _Index = std::uint32_t;
+
+        // The root is always record 0 and no record links to it, so 0 doubles as the null link
+        struct _Node {
+            value_type value;
+
+            _Index left;
+
+            _Index right;
+        };
+
+        struct _Header {
+            char magic[8];
+
+            std::uint32_t version;
+
+            std::uint32_t tag;
+
+            std::uint64_t count;
+
+            // Byte offset of the first record, which keeps the records aligned within the page-aligned mapping
+            std::uint64_t offset;
+        };
+
+        /* ------------------------------------------------Fields--------------------------------------------------- */
+        static constexpr char frozen_magic[8] = {'a', 'd', 't', ':', ':', 'f', 'z', 'n'};
+
+        static constexpr std::uint32_t frozen_version = 1;
+
+        static constexpr std::uint64_t node_offset = (sizeof(_Header) + alignof(_Node) - 1) / alignof(_Node) *
+                                                     alignof(_Node);
+
+        static constexpr size_type write_chunk = 1 << 13;
+
+        const void* mapping = nullptr;
+
+        size_type mapping_size = 0;
+
+        const _Node* nodes = nullptr;
+
+        size_type sz = 0;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        const _Node* _lower_bound(const_reference value) const noexcept {
+            if (this->sz == 0) {
+                return nullptr;
+            }
+
+            // Descend from the root, remembering the last node that is not less than `value`
+            const _Node* bound = nullptr;
+            const _Node* curr = this->nodes;
+            while (true) {
+                _Index next;
+                if (curr->value < value) {
+                    next = curr->right;
+                } else {
+                    bound = curr;
+                    next = curr->left;
+                }
+
+                if (next == 0) {
+                    return bound;
+                }
+                curr = this->nodes + next;
+            }
+        }
+
+        void _unmap() noexcept {
+            if (this->mapping != nullptr) {
+                ::munmap(const_cast<void*>(this->mapping), this->mapping_size);
+            }
+
+            this->mapping = nullptr;
+            this->mapping_size = 0;
+            this->nodes = nullptr;
+            this->sz = 0;
+        }
+
+    public:
+        /* ---------------------------------------------Constructors------------------------------------------------ */
+        frozen_search_tree() noexcept = default;
+
+        explicit frozen_search_tree(const std::filesystem::path& path) {
+            int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd == -1) {
+                throw std::system_error(errno, std::generic_category(),
+                                        "adt::frozen_search_tree::frozen_search_tree() error: cannot open the file");
+            }
+
+            struct stat info;
+            if (::fstat(fd, &info) == -1 || static_cast<std::uint64_t>(info.st_size) < sizeof(_Header)) {
+                ::close(fd);
+                throw std::runtime_error("adt::frozen_search_tree::frozen_search_tree() error: the file is truncated");
+            }
+
+            // Map the whole file shared and read-only; the mapping outlives the descriptor
+            this->mapping_size = static_cast<size_type>(info.st_size);
+            void* mapping = ::mmap(nullptr, this->mapping_size, PROT_READ, MAP_SHARED, fd, 0);
+            int error = errno;
+            ::close(fd);
+            if (mapping == MAP_FAILED) {
+                throw std::system_error(error, std::generic_category(),
+                                        "adt::frozen_search_tree::frozen_search_tree() error: cannot map the file");
+            }
+            this->mapping = mapping;
+
+            // Only the header and the file length are checked; the records themselves are used as they are
+            const _Header* header = static_cast<const _Header*>(this->mapping);
+            const char* error_message = nullptr;
+            if (!std::equal(header->magic, header->magic + sizeof(header->magic), frozen_magic)) {
+                error_message = "adt::frozen_search_tree::frozen_search_tree() error: the file is not a frozen BST";
+            } else if (header->version != frozen_version) {
+                error_message = "adt::frozen_search_tree::frozen_search_tree() error: unsupported file version";
+            } else if (header->tag != detail::bst_type_tag<value_type>()) {
+                error_message = "adt::frozen_search_tree::frozen_search_tree() error: the file holds a different type";
+            } else if (header->offset != node_offset || this->mapping_size < node_offset ||
+                       header->count > (this->mapping_size - node_offset) / sizeof(_Node)) {
+                error_message = "adt::frozen_search_tree::frozen_search_tree() error: the file is truncated";
+            }
+
+            if (error_message != nullptr) {
+                this->_unmap();
+                throw std::runtime_error(error_message);
+            }
+
+            this->nodes = reinterpret_cast<const _Node*>(static_cast<const char*>(this->mapping) + node_offset);
+            this->sz = static_cast<size_type>(header->count);
+        }
+
+        frozen_search_tree(const frozen_search_tree& other) = delete;
+
+        frozen_search_tree(frozen_search_tree&& other) noexcept
+            : mapping(std::exchange(other.mapping, nullptr)), mapping_size(std::exchange(other.mapping_size, 0)),
+              nodes(std::exchange(other.nodes, nullptr)), sz(std::exchange(other.sz, 0)) {}
+
+        /* -----------------------------------------------Destructor------------------------------------------------ */
+        ~frozen_search_tree() noexcept { this->_unmap(); }
+
+        /* ------------------------------------------Overloaded Operators------------------------------------------- */
+        frozen_search_tree& operator=(const frozen_search_tree& rhs) = delete;
+
+        frozen_search_tree& operator=(frozen_search_tree&& rhs) noexcept {
+            if (this != &rhs) {
+                this->_unmap();
+                this->mapping = std::exchange(rhs.mapping, nullptr);
+                this->mapping_size = std::exchange(rhs.mapping_size, 0);
+                this->nodes = std::exchange(rhs.nodes, nullptr);
+                this->sz = std::exchange(rhs.sz, 0);
+            }
+
+            return *this;
+        }
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        template<class Allocator>
+        static void freeze(const binary_search_tree<T, Allocator>& tree, const std::filesystem::path& path) {
+            std::vector<value_type> values(tree.cbegin(), tree.cend());
+            if (values.size() > std::numeric_limits<_Index>::max()) {
+                throw std::length_error("adt::frozen_search_tree::freeze() error: too many values for 32-bit links");
+            }
+
+            std::ofstream os(path, std::ios::binary | std::ios::trunc);
+
+            // Header, padded up to the first record
+            _Header header{};
+            std::copy(frozen_magic, frozen_magic + sizeof(frozen_magic), header.magic);
+            header.version = frozen_version;
+            header.tag = detail::bst_type_tag<value_type>();
+            header.count = values.size();
+            header.offset = node_offset;
+
+            char padding[node_offset] = {};
+            std::copy_n(reinterpret_cast<const char*>(&header), sizeof(header), padding);
+            os.write(padding, sizeof(padding));
+
+            // Lay out the balanced tree over `values` breadth first, so the top levels share the first few pages.
+            // A record's children are numbered as they are queued, which is the order they are written in
+            struct range { size_type first; size_type last; };
+            std::vector<range> queue;
+            queue.reserve(values.size() / 2 + 1);
+            if (!values.empty()) {
+                queue.push_back(range{0, values.size()});
+            }
+
+            std::vector<_Node> chunk;
+            chunk.reserve(write_chunk);
+            size_type next = 1;
+
+            for (size_type head = 0; head < queue.size(); head++) {
+                auto [first, last] = queue[head];
+                size_type mid = first + (last - first) / 2;
+
+                _Node node{values[mid], 0, 0};
+                if (first < mid) {
+                    node.left = static_cast<_Index>(next++);
+                    queue.push_back(range{first, mid});
+                }
+                if (mid + 1 < last) {
+                    node.right = static_cast<_Index>(next++);
+                    queue.push_back(range{mid + 1, last});
+                }
+
+                chunk.push_back(node);
+                if (chunk.size() == write_chunk) {
+                    os.write(reinterpret_cast<const char*>(chunk.data()),
+                             static_cast<std::streamsize>(chunk.size() * sizeof(_Node)));
+                    chunk.clear();
+                }
+            }
+            os.write(reinterpret_cast<const char*>(chunk.data()),
+                     static_cast<std::streamsize>(chunk.size() * sizeof(_Node)));
+
+            if (!os.flush()) {
+                throw std::runtime_error("adt::frozen_search_tree::freeze() error: the file could not be written");
+            }
+        }
+
+        [[nodiscard]] size_type size() const noexcept { return this->sz; }
+
+        [[nodiscard]] bool empty() const noexcept { return this->sz == 0; }
+
+        [[nodiscard]] size_type file_size() const noexcept { return this->mapping_size; }
+
+        [[nodiscard]] const_pointer find(const_reference value) const noexcept {
+            const _Node* bound = this->_lower_bound(value);
+            return (bound != nullptr && !(value < bound->value)) ? &bound->value : nullptr;
+        }
+
+        [[nodiscard]] bool contains(const_reference value) const noexcept { return this->find(value) != nullptr; }
+
+        [[nodiscard]] size_type count(const_reference value) const noexcept { return this->contains(value) ? 1 : 0; }
+
+        // The smallest value not less than `value`, or nullptr if there is none
+        [[nodiscard]] const_pointer lower_bound(const_reference value) const noexcept {
+            const _Node* bound = this->_lower_bound(value);
+            return (bound != nullptr) ? &bound->value : nullptr;
+        }
+
+        // The smallest value greater than `value`, or nullptr if there is none
+        [[nodiscard]] const_pointer upper_bound(const_reference value) const noexcept {
+            if (this->sz == 0) {
+                return nullptr;
+            }
+
+            const _Node* bound = nullptr;
+            const _Node* curr = this->nodes;
+            while (true) {
+                _Index next;
+                if (value < curr->value) {
+                    bound = curr;
+                    next = curr->left;
+                } else {
+                    next = curr->right;
+                }
+
+                if (next == 0) {
+                    return (bound != nullptr) ? &bound->value : nullptr;
+                }
+                curr = this->nodes + next;
+            }
+        }
+
+        template<class Function>
+        void for_each(Function function) const {
+            if (this->sz == 0) {
+                return;
+            }
+
+            // In-order walk with an explicit stack, since records have no parent links
+            std::vector<_Index> stack;
+            _Index curr = 0;
+            bool has_curr = true;
+
+            while (has_curr || !stack.empty()) {
+                while (has_curr) {
+                    stack.push_back(curr);
+                    curr = this->nodes[curr].left;
+                    has_curr = curr != 0;
+                }
+
+                const _Node& node = this->nodes[stack.back()];
+                stack.pop_back();
+                function(node.value);
+
+                curr = node.right;
+                has_curr = curr != 0;
+            }
+        }
+
+        void validate() const {
+            // Records only link forward, which rules out cycles, so a walk over in-range links always terminates
+            for (size_type i = 0; i < this->sz; i++) {
+                const _Node& node = this->nodes[i];
+                if ((node.left != 0 && (node.left <= i || node.left >= this->sz)) ||
+                    (node.right != 0 && (node.right <= i || node.right >= this->sz))) {
+                    throw std::runtime_error("adt::frozen_search_tree::validate() error: a link is out of range");
+                }
+            }
+
+            size_type visited = 0;
+            const_pointer previous = nullptr;
+            this->for_each([&](const_reference value) {
+                if (previous != nullptr && !(*previous < value)) {
+                    throw std::runtime_error("adt::frozen_search_tree::validate() error: the values are out of order");
+                }
+                previous = &value;
+
+                // A shared record is reached more than once, so stop before a crafted file makes this blow up
+                if (++visited > this->sz) {
+                    throw std::runtime_error("adt::frozen_search_tree::validate() error: records are shared");
+                }
+            });
+
+            if (visited != this->sz) {
+                throw std::runtime_error("adt::frozen_search_tree::validate() error: records are unreachable");
+            }
+        }
+    };
+} // adt
+
+
+#endif // FROZEN_SEARCH_TREE_HPP
@@ -0,0 +1,148 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "frozen_search_tree.hpp"
+
+/* --------------------------------------------Definitions--------------------------------------------------- */
+using value_type = int;
+
+using size_type = std::size_t;
+
+using binary_search_tree = adt::binary_search_tree<value_type>;
+
+using frozen_search_tree = adt::frozen_search_tree<value_type>;
+
+/* ---------------------------------------------Variables---------------------------------------------------- */
+constexpr std::initializer_list<value_type> frozen_init = {50, 30, 70, 20, 40, 60, 80, 10, 25, 35, 45, 55, 65};
+
+constexpr std::initializer_list<value_type> frozen_matcher = {10, 20, 25, 30, 35, 40, 45, 50, 55, 60, 65, 70, 80};
+
+/* ---------------------------------------------Functions---------------------------------------------------- */
+std::filesystem::path frozen_path(const std::string& name) {
+	return std::filesystem::temp_directory_path() / ("frozen_search_tree_tests_" + name + ".bin");
+}
+
+/* ---------------------------------------Frozen Search Tree Tests-------------------------------------------- */
+TEST(frozen_search_tree__constructors, default_constructor) {
+	frozen_search_tree fst;
+
+	EXPECT_TRUE(fst.empty());
+	EXPECT_FALSE(fst.contains(101));
+	EXPECT_EQ(fst.lower_bound(0), nullptr);
+}
+
+TEST(frozen_search_tree__methods, freeze_and_open__empty_bst) {
+	std::filesystem::path path = frozen_path("empty");
+	frozen_search_tree::freeze(binary_search_tree(), path);
+
+	frozen_search_tree fst(path);
+
+	EXPECT_TRUE(fst.empty());
+	EXPECT_EQ(fst.find(50), nullptr);
+	EXPECT_EQ(fst.upper_bound(50), nullptr);
+	EXPECT_NO_THROW(fst.validate());
+	std::filesystem::remove(path);
+}
+
+TEST(frozen_search_tree__methods, freeze_and_open__filled_bst) {
+	std::filesystem::path path = frozen_path("filled");
+	frozen_search_tree::freeze(binary_search_tree(frozen_init), path);
+
+	frozen_search_tree fst(path);
+	std::vector<value_type> values;
+	fst.for_each([&values](value_type value) { values.push_back(value); });
+
+	EXPECT_EQ(fst.size(), frozen_matcher.size());
+	EXPECT_THAT(values, ::testing::ElementsAreArray(frozen_matcher));
+	EXPECT_NO_THROW(fst.validate());
+
+	ASSERT_NE(fst.find(45), nullptr);
+	EXPECT_EQ(*fst.find(45), 45);
+	EXPECT_EQ(fst.find(46), nullptr);
+	EXPECT_EQ(*fst.lower_bound(46), 50);
+	EXPECT_EQ(*fst.lower_bound(50), 50);
+	EXPECT_EQ(*fst.upper_bound(50), 55);
+	EXPECT_EQ(*fst.lower_bound(0), 10);
+	EXPECT_EQ(fst.upper_bound(80), nullptr);
+	std::filesystem::remove(path);
+}
+
+TEST(frozen_search_tree__methods, open__shared_mappings) {
+	std::filesystem::path path = frozen_path("shared");
+	frozen_search_tree::freeze(binary_search_tree(frozen_init), path);
+
+	// Two mappings of one file read the same records, and each stays valid after the other goes away
+	frozen_search_tree first(path);
+	frozen_search_tree second(path);
+	frozen_search_tree moved(std::move(first));
+
+	EXPECT_TRUE(first.empty());
+	EXPECT_EQ(moved.file_size(), second.file_size());
+	second = frozen_search_tree();
+	EXPECT_TRUE(moved.contains(65));
+	EXPECT_FALSE(second.contains(65));
+	std::filesystem::remove(path);
+}
+
+TEST(frozen_search_tree__methods, randomized_against_std_set) {
+	std::filesystem::path path = frozen_path("randomized");
+	std::mt19937 rng(12345);
+	std::set<value_type> set;
+	binary_search_tree bst;
+
+	for (size_type i = 0; i < 5000; i++) {
+		value_type value = static_cast<value_type>(rng() % 20000);
+		set.insert(value);
+		bst.insert(value);
+	}
+	frozen_search_tree::freeze(bst, path);
+
+	frozen_search_tree fst(path);
+	ASSERT_EQ(fst.size(), set.size());
+
+	for (value_type value = -1; value <= 20001; value++) {
+		auto lower = set.lower_bound(value);
+		auto upper = set.upper_bound(value);
+
+		ASSERT_EQ(fst.contains(value), set.contains(value)) << value;
+		ASSERT_EQ(fst.lower_bound(value) == nullptr, lower == set.end()) << value;
+		ASSERT_EQ(fst.upper_bound(value) == nullptr, upper == set.end()) << value;
+		if (lower != set.end()) {
+			ASSERT_EQ(*fst.lower_bound(value), *lower) << value;
+		}
+		if (upper != set.end()) {
+			ASSERT_EQ(*fst.upper_bound(value), *upper) << value;
+		}
+	}
+	std::filesystem::remove(path);
+}
+
+TEST(frozen_search_tree__methods, open__invalid_files) {
+	std::filesystem::path path = frozen_path("invalid");
+	frozen_search_tree::freeze(binary_search_tree(frozen_init), path);
+	size_type size = std::filesystem::file_size(path);
+
+	// A frozen file opened as the wrong value type
+	EXPECT_THROW(adt::frozen_search_tree<long long>{path}, std::runtime_error);
+
+	// A file missing its last record
+	std::filesystem::resize_file(path, size - 1);
+	EXPECT_THROW(frozen_search_tree{path}, std::runtime_error);
+
+	// A file that is not a frozen BST at all
+	{
+		std::ofstream os(path, std::ios::binary | std::ios::trunc);
+		os << std::string(size, 'x');
+	}
+	EXPECT_THROW(frozen_search_tree{path}, std::runtime_error);
+
+	std::filesystem::remove(path);
+	EXPECT_THROW(frozen_search_tree{path}, std::system_error);
+}
@@ -0,0 +1,471 @@
+#ifndef LOCK_FREE_SEARCH_TREE_HPP
+#define LOCK_FREE_SEARCH_TREE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <initializer_list>
+#include <atomic>
+#include <limits>
+#include <utility>
+#include <vector>
+
+
+namespace adt {
+
+    template<class T, class Allocator = std::allocator<T>>
+    class lock_free_search_tree {
+    public:
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        using value_type = T;
+
+        using allocator_type = Allocator;
+
+        using size_type = std::size_t;
+
+        using difference_type = std::ptrdiff_t;
+
+        using reference = value_type&;
+
+        using const_reference = const value_type&;
+
+    protected:
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        // Values live in the leaves; internal nodes only route searches. Every edge carries two marks in the low
+        // bits of its pointer: a flag, set on the edge to a leaf that is being erased, and a tag, set on an edge
+        // that must no longer change because the node above it is being removed
+        struct _Node {
+            union {
+                value_type value;
+            };
+
+            // 0 for a real value, and 1, 2 and 3 for the sentinel values ∞0 < ∞1 < ∞2
+            std::uint8_t rank;
+
+            std::atomic<std::uintptr_t> left;
+
+            std::atomic<std::uintptr_t> right;
+
+            _Node(const_reference value, std::uintptr_t left, std::uintptr_t right)
+                : value(value), rank(0), left(left), right(right) {}
+
+            _Node(std::uint8_t rank, std::uintptr_t left, std::uintptr_t right)
+                : rank(rank), left(left), right(right) {}
+
+            _Node(const _Node* key, std::uintptr_t left, std::uintptr_t right)
+                : rank(key->rank), left(left), right(right) {
+                if (this->rank == 0) {
+                    std::construct_at(&this->value, key->value);
+                }
+            }
+
+            ~_Node() {
+                if (this->rank == 0) {
+                    std::destroy_at(&this->value);
+                }
+            }
+        };
+
+        struct _SeekRecord {
+            _Node* ancestor;
+
+            _Node* successor;
+
+            _Node* parent;
+
+            _Node* leaf;
+        };
+
+        // Each operation runs inside an epoch slot; nodes it removes wait in the slot's limbo lists until no
+        // operation that might still reach them is running
+        struct alignas(64) _EpochSlot {
+            std::atomic<std::uint64_t> epoch = inactive;
+
+            std::atomic<difference_type> size_delta = 0;
+
+            std::vector<_Node*> limbo[3];
+
+            std::uint64_t limbo_epoch[3] = {0, 0, 0};
+        };
+
+        using _NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<_Node>;
+
+        using node_allocator_traits = std::allocator_traits<_NodeAllocator>;
+
+        /* ------------------------------------------------Fields--------------------------------------------------- */
+        static constexpr std::uintptr_t flag_bit = 1;
+
+        static constexpr std::uintptr_t tag_bit = 2;
+
+        static constexpr std::uint64_t inactive = std::numeric_limits<std::uint64_t>::max();
+
+        static constexpr size_type epoch_slots = 64;
+
+        static constexpr size_type advance_threshold = 64;
+
+        // The sentinel root (∞2); its left child is the second sentinel (∞1), under which every real value lives
+        _Node* root;
+
+        mutable _EpochSlot slots[epoch_slots];
+
+        mutable std::atomic<std::uint64_t> global_epoch;
+
+        _NodeAllocator node_allocator;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        static _Node* _address(std::uintptr_t edge) noexcept {
+            return reinterpret_cast<_Node*>(edge & ~(flag_bit | tag_bit));
+        }
+
+        static std::uintptr_t _edge(const _Node* node, std::uintptr_t marks = 0) noexcept {
+            return reinterpret_cast<std::uintptr_t>(node) | marks;
+        }
+
+        static bool _less(const_reference value, const _Node* node) noexcept {
+            // Every real value is less than every sentinel
+            return node->rank != 0 || value < node->value;
+        }
+
+        static bool _equal(const_reference value, const _Node* node) noexcept {
+            return node->rank == 0 && node->value == value;
+        }
+
+        template<class... Args>
+        _Node* _construct_node(Args&&... args) {
+            _Node* node = node_allocator_traits::allocate(this->node_allocator, 1);
+            node_allocator_traits::construct(this->node_allocator, node, std::forward<Args>(args)...);
+            return node;
+        }
+
+        void _destroy_node(_Node* node) noexcept {
+            node_allocator_traits::destroy(this->node_allocator, node);
+            node_allocator_traits::deallocate(this->node_allocator, node, 1);
+        }
+
+        void _free(std::vector<_Node*>& nodes) noexcept {
+            for (_Node* node : nodes) {
+                this->_destroy_node(node);
+            }
+
+            nodes.clear();
+        }
+
+        _EpochSlot& _enter() const noexcept {
+            static std::atomic<size_type> next_hint = 0;
+            thread_local size_type hint = next_hint.fetch_add(1, std::memory_order_relaxed) % epoch_slots;
+
+            // Claim a free slot, starting from the one this thread used last
+            size_type i = hint;
+            std::uint64_t expected = inactive;
+            while (!this->slots[i].epoch.compare_exchange_strong(expected, this->global_epoch.load())) {
+                expected = inactive;
+                i = (i + 1) % epoch_slots;
+            }
+            hint = i;
+
+            // Announce the current epoch; if it moved on while announcing, announce the newer one
+            _EpochSlot& slot = this->slots[i];
+            std::uint64_t epoch = slot.epoch.load(std::memory_order_relaxed);
+            while (this->global_epoch.load() != epoch) {
+                epoch = this->global_epoch.load();
+                slot.epoch.store(epoch);
+            }
+
+            // Nodes retired two or more epochs ago can no longer be reached by any operation
+            for (size_type b = 0; b < 3; b++) {
+                if (slot.limbo_epoch[b] + 2 <= epoch) {
+                    const_cast<lock_free_search_tree*>(this)->_free(slot.limbo[b]);
+                }
+            }
+
+            return slot;
+        }
+
+        static void _leave(_EpochSlot& slot) noexcept { slot.epoch.store(inactive, std::memory_order_release); }
+
+        void _try_advance(std::uint64_t epoch) noexcept {
+            // The epoch can only advance once every running operation has seen the current one
+            for (const _EpochSlot& slot : this->slots) {
+                std::uint64_t announced = slot.epoch.load();
+                if (announced != inactive && announced != epoch) {
+                    return;
+                }
+            }
+
+            this->global_epoch.compare_exchange_strong(epoch, epoch + 1);
+        }
+
+        void _retire(_EpochSlot& slot, _Node* node) {
+            // Stamp the node with the epoch read after it was unlinked; the slot's own epoch may be one behind,
+            // and an operation that started in that epoch could still reach the node two epochs later
+            std::uint64_t epoch = this->global_epoch.load();
+            size_type b = epoch % 3;
+
+            // A bucket that belongs to an older epoch is at least three epochs old and can be freed
+            if (slot.limbo_epoch[b] != epoch) {
+                this->_free(slot.limbo[b]);
+                slot.limbo_epoch[b] = epoch;
+            }
+
+            slot.limbo[b].push_back(node);
+            if (slot.limbo[b].size() % advance_threshold == 0) {
+                this->_try_advance(epoch);
+            }
+        }
+
+        _SeekRecord _seek(const_reference value) const noexcept {
+            _SeekRecord record;
+            record.ancestor = this->root;
+            record.successor = _address(this->root->left.load(std::memory_order_acquire));
+            record.parent = record.successor;
+
+            std::uintptr_t parent_field = record.parent->left.load(std::memory_order_acquire);
+            record.leaf = _address(parent_field);
+
+            // Every real value is less than ∞0, so the first step below the second sentinel always goes left
+            std::uintptr_t current_field = record.leaf->left.load(std::memory_order_acquire);
+            _Node* current = _address(current_field);
+
+            while (current != nullptr) {
+                // The ancestor is the last node reached over an untagged edge, and the successor is its child
+                if (!(parent_field & tag_bit)) {
+                    record.ancestor = record.parent;
+                    record.successor = record.leaf;
+                }
+
+                record.parent = record.leaf;
+                record.leaf = current;
+                parent_field = current_field;
+
+                current_field = _less(value, current) ? current->left.load(std::memory_order_acquire)
+                                                      : current->right.load(std::memory_order_acquire);
+                current = _address(current_field);
+            }
+
+            return record;
+        }
+
+        void _retire_chain(_EpochSlot& slot, const_reference value, _Node* node, _Node* parent, _Node* kept) {
+            // Every node between the successor and the parent has a tagged edge on the search path and a flagged
+            // leaf on the other side; all of them were detached by the same CAS
+            while (node != parent) {
+                _Node* left = _address(node->left.load(std::memory_order_relaxed));
+                _Node* right = _address(node->right.load(std::memory_order_relaxed));
+                bool go_left = _less(value, node);
+
+                this->_retire(slot, go_left ? right : left);
+                this->_retire(slot, node);
+                node = go_left ? left : right;
+            }
+
+            // The parent loses the child that did not move up
+            _Node* left = _address(parent->left.load(std::memory_order_relaxed));
+            _Node* right = _address(parent->right.load(std::memory_order_relaxed));
+            this->_retire(slot, (left == kept) ? right : left);
+            this->_retire(slot, parent);
+        }
+
+        bool _cleanup(_EpochSlot& slot, const_reference value, const _SeekRecord& record) {
+            std::atomic<std::uintptr_t>& successor_field = _less(value, record.ancestor) ? record.ancestor->left
+                                                                                          : record.ancestor->right;
+            std::atomic<std::uintptr_t>* child_field = &record.parent->right;
+            std::atomic<std::uintptr_t>* sibling_field = &record.parent->left;
+            if (_less(value, record.parent)) {
+                std::swap(child_field, sibling_field);
+            }
+
+            // If the leaf on the search path is not the one being erased, it is the one that moves up
+            if (!(child_field->load(std::memory_order_acquire) & flag_bit)) {
+                sibling_field = child_field;
+            }
+
+            // Freeze the edge to the node that moves up, then swing the ancestor's edge past the parent,
+            // keeping the moved node's flag in case it is being erased as well
+            sibling_field->fetch_or(tag_bit, std::memory_order_acq_rel);
+            std::uintptr_t sibling = sibling_field->load(std::memory_order_acquire);
+
+            std::uintptr_t expected = _edge(record.successor);
+            if (!successor_field.compare_exchange_strong(expected, _edge(_address(sibling), sibling & flag_bit),
+                                                         std::memory_order_acq_rel, std::memory_order_acquire)) {
+                return false;
+            }
+
+            this->_retire_chain(slot, value, record.successor, record.parent, _address(sibling));
+
+            return true;
+        }
+
+    public:
+        /* ---------------------------------------------Constructors------------------------------------------------ */
+        explicit lock_free_search_tree(const allocator_type& allocator = allocator_type())
+            : global_epoch(0), node_allocator(allocator) {
+            // Build the sentinel frame: ∞2 at the root, ∞1 below it, and the leaves ∞0, ∞1 and ∞2
+            _Node* infinity_0 = this->_construct_node(std::uint8_t(1), 0, 0);
+            _Node* infinity_1 = this->_construct_node(std::uint8_t(2), 0, 0);
+            _Node* infinity_2 = this->_construct_node(std::uint8_t(3), 0, 0);
+            _Node* second = this->_construct_node(std::uint8_t(2), _edge(infinity_0), _edge(infinity_1));
+            this->root = this->_construct_node(std::uint8_t(3), _edge(second), _edge(infinity_2));
+        }
+
+        lock_free_search_tree(std::initializer_list<value_type> values,
+                              const allocator_type& allocator = allocator_type())
+            : lock_free_search_tree(allocator) {
+            for (const_reference value : values) {
+                this->insert(value);
+            }
+        }
+
+        lock_free_search_tree(const lock_free_search_tree& other) = delete;
+
+        lock_free_search_tree(lock_free_search_tree&& other) = delete;
+
+        /* -----------------------------------------------Destructor------------------------------------------------ */
+        ~lock_free_search_tree() noexcept {
+            std::vector<_Node*> pending = {this->root};
+
+            // No operation can outlive the BST, so every reachable and every retired node is freed here
+            while (!pending.empty()) {
+                _Node* node = pending.back();
+                pending.pop_back();
+
+                if (_Node* left = _address(node->left.load(std::memory_order_relaxed)); left != nullptr) {
+                    pending.push_back(left);
+                }
+                if (_Node* right = _address(node->right.load(std::memory_order_relaxed)); right != nullptr) {
+                    pending.push_back(right);
+                }
+
+                this->_destroy_node(node);
+            }
+
+            for (_EpochSlot& slot : this->slots) {
+                for (std::vector<_Node*>& limbo : slot.limbo) {
+                    this->_free(limbo);
+                }
+            }
+        }
+
+        /* ------------------------------------------Overloaded Operators------------------------------------------- */
+        lock_free_search_tree& operator=(const lock_free_search_tree& rhs) = delete;
+
+        lock_free_search_tree& operator=(lock_free_search_tree&& rhs) = delete;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        [[nodiscard]] allocator_type get_allocator() const noexcept { return allocator_type(this->node_allocator); }
+
+        [[nodiscard]] size_type size() const noexcept {
+            // Exact when no writer is running; otherwise a value the size had at some point during the call
+            difference_type size = 0;
+            for (const _EpochSlot& slot : this->slots) {
+                size += slot.size_delta.load(std::memory_order_relaxed);
+            }
+
+            return static_cast<size_type>(size);
+        }
+
+        [[nodiscard]] bool empty() const noexcept { return this->size() == 0; }
+
+        [[nodiscard]] bool contains(const_reference value) const noexcept {
+            _EpochSlot& slot = this->_enter();
+
+            // Descend to the leaf where `value` would be
+            const _Node* node = this->root;
+            for (_Node* next = _address(node->left.load(std::memory_order_acquire)); next != nullptr;) {
+                node = next;
+                next = _less(value, node) ? _address(node->left.load(std::memory_order_acquire))
+                                          : _address(node->right.load(std::memory_order_acquire));
+            }
+            bool found = _equal(value, node);
+
+            _leave(slot);
+
+            return found;
+        }
+
+        [[nodiscard]] size_type count(const_reference value) const noexcept { return this->contains(value) ? 1 : 0; }
+
+        bool insert(const_reference value) {
+            _EpochSlot& slot = this->_enter();
+
+            while (true) {
+                _SeekRecord record = this->_seek(value);
+                _Node* leaf = record.leaf;
+
+                if (_equal(value, leaf)) {
+                    _leave(slot);
+                    return false;
+                }
+
+                // Replace the leaf with an internal node whose children are the leaf and the new value
+                _Node* new_leaf = this->_construct_node(value, 0, 0);
+                _Node* new_internal = _less(value, leaf)
+                    ? this->_construct_node(static_cast<const _Node*>(leaf), _edge(new_leaf), _edge(leaf))
+                    : this->_construct_node(static_cast<const _Node*>(new_leaf), _edge(leaf), _edge(new_leaf));
+
+                std::atomic<std::uintptr_t>& child_field = _less(value, record.parent) ? record.parent->left
+                                                                                        : record.parent->right;
+                std::uintptr_t expected = _edge(leaf);
+                if (child_field.compare_exchange_strong(expected, _edge(new_internal),
+                                                        std::memory_order_acq_rel, std::memory_order_acquire)) {
+                    slot.size_delta.store(slot.size_delta.load(std::memory_order_relaxed) + 1,
+                                          std::memory_order_relaxed);
+                    _leave(slot);
+                    return true;
+                }
+
+                // The new nodes were never published, so they can be freed right away
+                this->_destroy_node(new_internal);
+                this->_destroy_node(new_leaf);
+
+                // If the leaf is being erased, help finish that first
+                if (_address(expected) == leaf && (expected & (flag_bit | tag_bit))) {
+                    this->_cleanup(slot, value, record);
+                }
+            }
+        }
+
+        size_type erase(const_reference value) {
+            _EpochSlot& slot = this->_enter();
+            _Node* leaf = nullptr;
+
+            while (true) {
+                _SeekRecord record = this->_seek(value);
+
+                if (leaf == nullptr) {
+                    // Injection: flag the edge to the leaf, which linearizes the erase
+                    if (!_equal(value, record.leaf)) {
+                        _leave(slot);
+                        return 0;
+                    }
+
+                    std::atomic<std::uintptr_t>& child_field = _less(value, record.parent) ? record.parent->left
+                                                                                            : record.parent->right;
+                    std::uintptr_t expected = _edge(record.leaf);
+                    if (child_field.compare_exchange_strong(expected, _edge(record.leaf, flag_bit),
+                                                            std::memory_order_acq_rel, std::memory_order_acquire)) {
+                        leaf = record.leaf;
+                        if (this->_cleanup(slot, value, record)) {
+                            break;
+                        }
+                    } else if (_address(expected) == record.leaf && (expected & (flag_bit | tag_bit))) {
+                        // Another erase is in progress at this leaf; help finish it
+                        this->_cleanup(slot, value, record);
+                    }
+                } else {
+                    // Cleanup: keep trying to remove the flagged leaf, unless another thread already has
+                    if (record.leaf != leaf || this->_cleanup(slot, value, record)) {
+                        break;
+                    }
+                }
+            }
+
+            slot.size_delta.store(slot.size_delta.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+            _leave(slot);
+
+            return 1;
+        }
+    };
+} // adt
+
+
+#endif // LOCK_FREE_SEARCH_TREE_HPP
@@ -0,0 +1,177 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "lock_free_search_tree.hpp"
+
+/* --------------------------------------------Definitions--------------------------------------------------- */
+using value_type = int;
+
+using size_type = std::size_t;
+
+using lock_free_search_tree = adt::lock_free_search_tree<value_type>;
+
+/* ---------------------------------------------Variables---------------------------------------------------- */
+constexpr std::initializer_list<value_type> lock_free_init = {50, 30, 70, 20, 40, 60, 80, 10, 25, 35, 45, 55, 65};
+
+constexpr size_type stress_threads = 4;
+
+/* -------------------------------------Lock Free Search Tree Tests------------------------------------------- */
+TEST(lock_free_search_tree__constructors, default_constructor) {
+	lock_free_search_tree lfst;
+
+	EXPECT_TRUE(lfst.empty());
+	EXPECT_EQ(lfst.size(), 0);
+	EXPECT_FALSE(lfst.contains(101));
+	EXPECT_EQ(lfst.erase(101), 0);
+}
+
+TEST(lock_free_search_tree__constructors, initializer_list_constructor) {
+	lock_free_search_tree lfst = lock_free_init;
+
+	EXPECT_EQ(lfst.size(), lock_free_init.size());
+	for (value_type value : lock_free_init) {
+		EXPECT_TRUE(lfst.contains(value));
+	}
+	EXPECT_FALSE(lfst.contains(101));
+}
+
+TEST(lock_free_search_tree__methods, insert_and_erase) {
+	lock_free_search_tree lfst = lock_free_init;
+
+	EXPECT_TRUE(lfst.insert(42));
+	EXPECT_FALSE(lfst.insert(42));
+	EXPECT_EQ(lfst.count(42), 1);
+	EXPECT_EQ(lfst.size(), lock_free_init.size() + 1);
+
+	EXPECT_EQ(lfst.erase(10), 1);
+	EXPECT_EQ(lfst.erase(30), 1);
+	EXPECT_EQ(lfst.erase(30), 0);
+
+	EXPECT_FALSE(lfst.contains(10));
+	EXPECT_FALSE(lfst.contains(30));
+	EXPECT_TRUE(lfst.contains(25));
+	EXPECT_TRUE(lfst.contains(35));
+	EXPECT_EQ(lfst.size(), lock_free_init.size() - 1);
+
+	// Emptying the BST leaves only the sentinels, after which it is usable again
+	for (value_type value : lock_free_init) {
+		lfst.erase(value);
+	}
+	lfst.erase(42);
+	EXPECT_TRUE(lfst.empty());
+
+	EXPECT_TRUE(lfst.insert(30));
+	EXPECT_TRUE(lfst.contains(30));
+}
+
+TEST(lock_free_search_tree__methods, disjoint_writers) {
+	lock_free_search_tree lfst;
+	std::vector<std::thread> writers;
+
+	// Each writer owns the keys congruent to its index, so the final contents are known exactly
+	for (size_type t = 0; t < stress_threads; t++) {
+		writers.emplace_back([&, t] {
+			for (value_type value = t; value < 4000; value += stress_threads) {
+				lfst.insert(value);
+			}
+			for (value_type value = t; value < 4000; value += 2 * stress_threads) {
+				lfst.erase(value);
+			}
+		});
+	}
+
+	for (std::thread& writer : writers) {
+		writer.join();
+	}
+
+	EXPECT_EQ(lfst.size(), 2000);
+	for (value_type value = 0; value < 4000; value++) {
+		EXPECT_EQ(lfst.contains(value), value % (2 * stress_threads) >= stress_threads) << value;
+	}
+}
+
+TEST(lock_free_search_tree__methods, contended_writers) {
+	lock_free_search_tree lfst;
+	constexpr value_type keys = 64;
+
+	std::vector<std::atomic<int>> balance(keys);
+	std::vector<std::thread> writers;
+
+	// Every thread races on the same few keys; each successful insert and erase is linearized, so per key they
+	// alternate, and the surplus of inserts over erases is whether the key is present at the end
+	for (size_type t = 0; t < stress_threads; t++) {
+		writers.emplace_back([&, t] {
+			for (size_type i = 0; i < 20000; i++) {
+				value_type value = static_cast<value_type>((i * 7 + t * 13) % keys);
+				if ((i + t) % 2 == 0) {
+					balance[value] += lfst.insert(value) ? 1 : 0;
+				} else {
+					balance[value] -= static_cast<int>(lfst.erase(value));
+				}
+			}
+		});
+	}
+
+	for (std::thread& writer : writers) {
+		writer.join();
+	}
+
+	size_type present = 0;
+	for (value_type value = 0; value < keys; value++) {
+		ASSERT_TRUE(balance[value] == 0 || balance[value] == 1) << value;
+		EXPECT_EQ(lfst.contains(value), balance[value] == 1) << value;
+		present += balance[value];
+	}
+	EXPECT_EQ(lfst.size(), present);
+}
+
+TEST(lock_free_search_tree__methods, readers_with_concurrent_writers) {
+	lock_free_search_tree lfst;
+
+	// Even keys are never removed; odd keys are inserted and erased while readers run
+	for (value_type value = 0; value < 512; value += 2) {
+		lfst.insert((value * 37) % 512);
+	}
+
+	std::atomic<bool> done = false;
+	std::atomic<size_type> missing = 0;
+	std::vector<std::thread> threads;
+
+	for (size_type r = 0; r < 2; r++) {
+		threads.emplace_back([&] {
+			while (!done.load()) {
+				for (value_type value = 0; value < 512; value += 2) {
+					if (!lfst.contains((value * 37) % 512)) {
+						missing++;
+					}
+				}
+			}
+		});
+	}
+
+	for (size_type w = 0; w < 2; w++) {
+		threads.emplace_back([&, w] {
+			for (size_type round = 0; round < 100; round++) {
+				for (value_type value = 1 + 2 * w; value < 512; value += 4) {
+					lfst.insert(value);
+				}
+				for (value_type value = 1 + 2 * w; value < 512; value += 4) {
+					lfst.erase(value);
+				}
+			}
+		});
+	}
+
+	threads[2].join();
+	threads[3].join();
+	done = true;
+	threads[0].join();
+	threads[1].join();
+
+	EXPECT_EQ(missing.load(), 0);
+	EXPECT_EQ(lfst.size(), 256);
+}
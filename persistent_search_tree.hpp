@@ -0,0 +1,423 @@
+#ifndef PERSISTENT_SEARCH_TREE_HPP
+#define PERSISTENT_SEARCH_TREE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <initializer_list>
+#include <stdexcept>
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+
+namespace adt {
+
+    template<class T, class Allocator = std::allocator<T>>
+    class persistent_search_tree {
+    public:
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        using value_type = T;
+
+        using allocator_type = Allocator;
+
+        using size_type = std::size_t;
+
+        using difference_type = std::ptrdiff_t;
+
+        using reference = value_type&;
+
+        using const_reference = const value_type&;
+
+        using pointer = typename std::allocator_traits<Allocator>::pointer;
+
+        using const_pointer = typename std::allocator_traits<Allocator>::const_pointer;
+
+    protected:
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        struct _Node {
+            value_type value;
+
+            const _Node* left;
+
+            const _Node* right;
+
+            // Number of versions and parent nodes that share this node
+            mutable std::atomic<size_type> refs;
+        };
+
+        using _NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<_Node>;
+
+        using node_allocator_traits = std::allocator_traits<_NodeAllocator>;
+
+        /* ------------------------------------------------Fields--------------------------------------------------- */
+        const _Node* root;
+
+        size_type sz;
+
+        _NodeAllocator node_allocator;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        constexpr const _Node* _construct_node(const_reference value, const _Node* left, const _Node* right) {
+            // The new node adopts one reference to each of its children
+            _Node* node = node_allocator_traits::allocate(this->node_allocator, 1);
+            node_allocator_traits::construct(this->node_allocator, node, value, left, right, 1);
+            return node;
+        }
+
+        static constexpr const _Node* _retain(const _Node* node) noexcept {
+            if (node != nullptr) {
+                node->refs.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            return node;
+        }
+
+        constexpr void _release(const _Node* node) noexcept {
+            std::vector<const _Node*> pending;
+
+            // Drop one reference and free every node that is no longer shared; the walk is iterative so that
+            // releasing a degenerate version cannot overflow the stack
+            while (node != nullptr || !pending.empty()) {
+                if (node == nullptr) {
+                    node = pending.back();
+                    pending.pop_back();
+                }
+
+                if (node->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                    node = nullptr;
+                    continue;
+                }
+
+                if (node->right != nullptr) {
+                    pending.push_back(node->right);
+                }
+                const _Node* left = node->left;
+
+                _Node* target = const_cast<_Node*>(node);
+                node_allocator_traits::destroy(this->node_allocator, target);
+                node_allocator_traits::deallocate(this->node_allocator, target, 1);
+
+                node = left;
+            }
+        }
+
+        constexpr const _Node* _build_sorted(const value_type* values, size_type count) {
+            if (count == 0) {
+                return nullptr;
+            }
+
+            // Make the middle value the root of this subtree and build both halves below it
+            size_type mid = count / 2;
+            const _Node* left = this->_build_sorted(values, mid);
+            const _Node* right = this->_build_sorted(values + mid + 1, count - mid - 1);
+
+            return this->_construct_node(values[mid], left, right);
+        }
+
+        constexpr const _Node* _copy_path(const std::vector<const _Node*>& path, const _Node* child,
+                                          const_reference value) {
+            // Copy each node on the search path from the bottom up, pointing the copy at the new child on the
+            // side of the search and sharing the untouched sibling
+            for (auto it = path.rbegin(); it != path.rend(); ++it) {
+                const _Node* node = *it;
+                if (value < node->value) {
+                    child = this->_construct_node(node->value, child, _retain(node->right));
+                } else {
+                    child = this->_construct_node(node->value, _retain(node->left), child);
+                }
+            }
+
+            return child;
+        }
+
+        constexpr const _Node* _remove_min(const _Node* node) {
+            std::vector<const _Node*> spine;
+
+            // Walk the left spine down to the minimum node
+            while (node->left != nullptr) {
+                spine.push_back(node);
+                node = node->left;
+            }
+
+            // Replace the minimum node with its right subtree and copy the spine above it
+            const _Node* child = _retain(node->right);
+            for (auto it = spine.rbegin(); it != spine.rend(); ++it) {
+                child = this->_construct_node((*it)->value, child, _retain((*it)->right));
+            }
+
+            return child;
+        }
+
+        constexpr persistent_search_tree(const _Node* root, size_type sz, const _NodeAllocator& allocator) noexcept
+            : root(root), sz(sz), node_allocator(allocator) {}
+
+    public:
+        /* -------------------------------------------Constant Iterator--------------------------------------------- */
+        class const_iterator {
+        private:
+            /* --------------------------------------------Friends-------------------------------------------------- */
+            friend class persistent_search_tree;
+
+        protected:
+            /* ---------------------------------------------Fields-------------------------------------------------- */
+            // The current node is on top, followed by the ancestors that are still to be visited
+            std::vector<const _Node*> stack;
+
+            /* ---------------------------------------------Methods------------------------------------------------- */
+            constexpr void _push_left(const _Node* node) {
+                for (; node != nullptr; node = node->left) {
+                    this->stack.push_back(node);
+                }
+            }
+
+        public:
+            /* -------------------------------------------Definitions----------------------------------------------- */
+            using iterator_category = std::forward_iterator_tag;
+
+            using value_type = persistent_search_tree::value_type;
+
+            using difference_type = persistent_search_tree::difference_type;
+
+            using pointer = const value_type*;
+
+            using reference = const value_type&;
+
+            /* ------------------------------------------Constructors----------------------------------------------- */
+            constexpr const_iterator() noexcept = default;
+
+            /* ---------------------------------------Overloaded Operators------------------------------------------ */
+            constexpr reference operator*() const {
+                if (this->stack.empty()) {
+                    throw std::runtime_error("adt::persistent_search_tree::const_iterator::operator*() error: "
+                                             "dereferencing the end iterator");
+                }
+
+                return this->stack.back()->value;
+            }
+
+            constexpr pointer operator->() const { return &(**this); }
+
+            constexpr const_iterator& operator++() {
+                if (this->stack.empty()) {
+                    throw std::runtime_error("adt::persistent_search_tree::const_iterator::operator++() error: "
+                                             "incrementing the end iterator");
+                }
+
+                // Visit the leftmost node of the right subtree, or else the nearest unvisited ancestor
+                const _Node* node = this->stack.back();
+                this->stack.pop_back();
+                this->_push_left(node->right);
+
+                return *this;
+            }
+
+            constexpr const_iterator operator++(int) {
+                const_iterator temp = *this;
+                ++(*this);
+                return temp;
+            }
+
+            friend constexpr bool operator==(const const_iterator& lhs, const const_iterator& rhs) noexcept {
+                if (lhs.stack.empty() || rhs.stack.empty()) {
+                    return lhs.stack.empty() && rhs.stack.empty();
+                }
+
+                return lhs.stack.back() == rhs.stack.back();
+            }
+        };
+
+        using iterator = const_iterator;
+
+        /* ---------------------------------------------Constructors------------------------------------------------ */
+        constexpr persistent_search_tree() noexcept : root(nullptr), sz(0), node_allocator() {}
+
+        constexpr explicit persistent_search_tree(const allocator_type& allocator) noexcept
+            : root(nullptr), sz(0), node_allocator(allocator) {}
+
+        template<std::input_iterator InputIt>
+        constexpr persistent_search_tree(InputIt first, InputIt last, 
+                                         const allocator_type& allocator = allocator_type())
+            : root(nullptr), sz(0), node_allocator(allocator) {
+            std::vector<value_type> values(first, last);
+
+            // The first version is built balanced from the sorted, deduplicated values
+            std::sort(values.begin(), values.end());
+            values.erase(std::unique(values.begin(), values.end()), values.end());
+
+            this->root = this->_build_sorted(values.data(), values.size());
+            this->sz = values.size();
+        }
+
+        constexpr persistent_search_tree(std::initializer_list<value_type> values,
+                                         const allocator_type& allocator = allocator_type())
+            : persistent_search_tree(values.begin(), values.end(), allocator) {}
+
+        constexpr persistent_search_tree(const persistent_search_tree& other) noexcept
+            : root(_retain(other.root)), sz(other.sz), node_allocator(other.node_allocator) {}
+
+        constexpr persistent_search_tree(persistent_search_tree&& other) noexcept
+            : root(other.root), sz(other.sz), node_allocator(other.node_allocator) {
+            other.root = nullptr;
+            other.sz = 0;
+        }
+
+        /* -----------------------------------------------Destructor------------------------------------------------ */
+        constexpr ~persistent_search_tree() noexcept { this->_release(this->root); }
+
+        /* ------------------------------------------Overloaded Operators------------------------------------------- */
+        constexpr persistent_search_tree& operator=(const persistent_search_tree& rhs) noexcept {
+            // Retain before releasing so that self-assignment keeps the shared nodes alive
+            const _Node* old_root = this->root;
+            this->root = _retain(rhs.root);
+            this->sz = rhs.sz;
+            this->_release(old_root);
+
+            return *this;
+        }
+
+        constexpr persistent_search_tree& operator=(persistent_search_tree&& rhs) noexcept {
+            // Protect against self-assignment
+            if (this == &rhs) {
+                return *this;
+            }
+
+            this->_release(this->root);
+            this->root = rhs.root;
+            this->sz = rhs.sz;
+            rhs.root = nullptr;
+            rhs.sz = 0;
+
+            return *this;
+        }
+
+        friend constexpr bool operator==(const persistent_search_tree& lhs, const persistent_search_tree& rhs) {
+            // Versions that share a root are equal without comparing any values
+            if (lhs.root == rhs.root) {
+                return true;
+            }
+
+            return lhs.sz == rhs.sz && std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend());
+        }
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+            return allocator_type(this->node_allocator);
+        }
+
+        [[nodiscard]] constexpr bool empty() const noexcept { return this->sz == 0; }
+
+        [[nodiscard]] constexpr size_type size() const noexcept { return this->sz; }
+
+        [[nodiscard]] constexpr const_iterator begin() const { return this->cbegin(); }
+
+        [[nodiscard]] constexpr const_iterator end() const noexcept { return this->cend(); }
+
+        [[nodiscard]] constexpr const_iterator cbegin() const {
+            const_iterator cit;
+            cit._push_left(this->root);
+            return cit;
+        }
+
+        [[nodiscard]] constexpr const_iterator cend() const noexcept { return const_iterator(); }
+
+        [[nodiscard]] constexpr persistent_search_tree snapshot() const noexcept { return *this; }
+
+        [[nodiscard]] constexpr persistent_search_tree insert(const_reference value) const {
+            std::vector<const _Node*> path;
+
+            // Record the search path, returning this version unchanged if `value` is already present
+            for (const _Node* curr = this->root; curr != nullptr;) {
+                if (curr->value == value) {
+                    return *this;
+                }
+
+                path.push_back(curr);
+                curr = (value < curr->value) ? curr->left : curr->right;
+            }
+
+            // Copy the path above a new leaf; every subtree off the path is shared with this version
+            persistent_search_tree version(nullptr, this->sz + 1, this->node_allocator);
+            version.root = version._copy_path(path, version._construct_node(value, nullptr, nullptr), value);
+
+            return version;
+        }
+
+        [[nodiscard]] constexpr persistent_search_tree erase(const_reference value) const {
+            std::vector<const _Node*> path;
+            const _Node* target = this->root;
+
+            // Record the search path, returning this version unchanged if `value` is not present
+            while (target != nullptr && target->value != value) {
+                path.push_back(target);
+                target = (value < target->value) ? target->left : target->right;
+            }
+
+            if (target == nullptr) {
+                return *this;
+            }
+
+            persistent_search_tree version(nullptr, this->sz - 1, this->node_allocator);
+            const _Node* replacement;
+
+            if (target->left == nullptr) {
+                // Replace the target with its right subtree
+                replacement = _retain(target->right);
+            } else if (target->right == nullptr) {
+                // Replace the target with its left subtree
+                replacement = _retain(target->left);
+            } else {
+                // Replace the target with a copy of its successor, removed from the right subtree
+                const _Node* successor = target->right;
+                while (successor->left != nullptr) {
+                    successor = successor->left;
+                }
+
+                const _Node* right = version._remove_min(target->right);
+                replacement = version._construct_node(successor->value, _retain(target->left), right);
+            }
+
+            version.root = version._copy_path(path, replacement, value);
+
+            return version;
+        }
+
+        [[nodiscard]] constexpr const_iterator find(const_reference value) const {
+            const_iterator cit;
+
+            // Descend towards `value`, keeping the ancestors whose values follow it in the stack
+            for (const _Node* curr = this->root; curr != nullptr;) {
+                if (curr->value == value) {
+                    cit.stack.push_back(curr);
+                    return cit;
+                }
+
+                if (value < curr->value) {
+                    cit.stack.push_back(curr);
+                    curr = curr->left;
+                } else {
+                    curr = curr->right;
+                }
+            }
+
+            return this->cend();
+        }
+
+        [[nodiscard]] constexpr bool contains(const_reference value) const noexcept {
+            const _Node* curr = this->root;
+            while (curr != nullptr && curr->value != value) {
+                curr = (value < curr->value) ? curr->left : curr->right;
+            }
+
+            return curr != nullptr;
+        }
+
+        [[nodiscard]] constexpr size_type count(const_reference value) const noexcept {
+            return this->contains(value) ? 1 : 0;
+        }
+    };
+} // adt
+
+
+#endif // PERSISTENT_SEARCH_TREE_HPP
@@ -0,0 +1,193 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <numeric>
+#include <bit>
+
+#include "persistent_search_tree.hpp"
+
+/* --------------------------------------------Definitions--------------------------------------------------- */
+using value_type = int;
+
+using size_type = std::size_t;
+
+inline size_type allocated_nodes = 0;
+
+template<class T>
+struct counting_allocator {
+	using value_type = T;
+
+	counting_allocator() noexcept = default;
+
+	template<class U>
+	counting_allocator(const counting_allocator<U>&) noexcept {}
+
+	T* allocate(size_type n) {
+		allocated_nodes += n;
+		return std::allocator<T>().allocate(n);
+	}
+
+	void deallocate(T* p, size_type n) noexcept {
+		allocated_nodes -= n;
+		std::allocator<T>().deallocate(p, n);
+	}
+
+	friend bool operator==(const counting_allocator&, const counting_allocator&) noexcept { return true; }
+};
+
+using persistent_search_tree = adt::persistent_search_tree<value_type>;
+
+using counted_search_tree = adt::persistent_search_tree<value_type, counting_allocator<value_type>>;
+
+/* ---------------------------------------------Variables---------------------------------------------------- */
+constexpr std::initializer_list<value_type> persistent_init = {50, 30, 70, 20, 40, 60, 80, 10, 25, 35, 45, 55, 65};
+
+constexpr std::initializer_list<value_type> persistent_matcher = {10, 20, 25, 30, 35, 40, 45, 50, 55, 60, 65, 70, 80};
+
+/* -------------------------------------Persistent Search Tree Tests------------------------------------------ */
+TEST(persistent_search_tree__constructors, default_constructor) {
+	persistent_search_tree pst;
+
+	EXPECT_TRUE(pst.empty());
+	EXPECT_EQ(pst.size(), 0);
+	EXPECT_EQ(pst.cbegin(), pst.cend());
+}
+
+TEST(persistent_search_tree__constructors, initializer_list_constructor) {
+	persistent_search_tree pst = persistent_init;
+
+	EXPECT_EQ(pst.size(), persistent_matcher.size());
+	EXPECT_TRUE(std::equal(pst.cbegin(), pst.cend(), persistent_matcher.begin(), persistent_matcher.end()));
+}
+
+TEST(persistent_search_tree__constructors, range_constructor__duplicates) {
+	std::vector<value_type> values = {5, 3, 5, 1, 3, 9};
+	persistent_search_tree pst(values.begin(), values.end());
+	std::vector<value_type> matcher = {1, 3, 5, 9};
+
+	EXPECT_EQ(pst.size(), 4);
+	EXPECT_TRUE(std::equal(pst.cbegin(), pst.cend(), matcher.begin(), matcher.end()));
+}
+
+TEST(persistent_search_tree__methods, insert__old_version_unchanged) {
+	persistent_search_tree v0 = persistent_init;
+	persistent_search_tree v1 = v0.insert(42);
+
+	EXPECT_EQ(v0.size(), persistent_matcher.size());
+	EXPECT_FALSE(v0.contains(42));
+	EXPECT_TRUE(std::equal(v0.cbegin(), v0.cend(), persistent_matcher.begin(), persistent_matcher.end()));
+
+	EXPECT_EQ(v1.size(), persistent_matcher.size() + 1);
+	EXPECT_TRUE(v1.contains(42));
+	EXPECT_TRUE(std::is_sorted(v1.cbegin(), v1.cend()));
+}
+
+TEST(persistent_search_tree__methods, insert__duplicate) {
+	persistent_search_tree v0 = persistent_init;
+	persistent_search_tree v1 = v0.insert(50);
+
+	EXPECT_EQ(v1.size(), v0.size());
+	EXPECT_EQ(v1, v0);
+}
+
+TEST(persistent_search_tree__methods, insert__copies_only_the_path) {
+	std::vector<value_type> values(1023);
+	std::iota(values.begin(), values.end(), 0);
+
+	counted_search_tree v0(values.begin(), values.end());
+	size_type before = allocated_nodes;
+
+	// A balanced BST of 1023 nodes has 10 levels, so the new leaf and the 10 nodes above it are allocated
+	counted_search_tree v1 = v0.insert(2000);
+
+	EXPECT_EQ(allocated_nodes - before, std::bit_width(values.size()) + 1);
+	EXPECT_EQ(v1.size(), values.size() + 1);
+}
+
+TEST(persistent_search_tree__methods, erase__leaf_one_child_two_children) {
+	persistent_search_tree v0 = persistent_init;
+
+	persistent_search_tree leaf = v0.erase(10);
+	persistent_search_tree one_child = v0.erase(80).erase(70);
+	persistent_search_tree two_children = v0.erase(30);
+
+	EXPECT_EQ(leaf.size(), v0.size() - 1);
+	EXPECT_FALSE(leaf.contains(10));
+	EXPECT_TRUE(std::is_sorted(leaf.cbegin(), leaf.cend()));
+
+	EXPECT_EQ(one_child.size(), v0.size() - 2);
+	EXPECT_FALSE(one_child.contains(70));
+	EXPECT_TRUE(std::is_sorted(one_child.cbegin(), one_child.cend()));
+
+	EXPECT_EQ(two_children.size(), v0.size() - 1);
+	EXPECT_FALSE(two_children.contains(30));
+	EXPECT_TRUE(two_children.contains(35));
+	EXPECT_TRUE(std::is_sorted(two_children.cbegin(), two_children.cend()));
+
+	EXPECT_TRUE(std::equal(v0.cbegin(), v0.cend(), persistent_matcher.begin(), persistent_matcher.end()));
+}
+
+TEST(persistent_search_tree__methods, erase__non_existant) {
+	persistent_search_tree v0 = persistent_init;
+	persistent_search_tree v1 = v0.erase(11);
+
+	EXPECT_EQ(v1, v0);
+	EXPECT_EQ(v1.size(), v0.size());
+}
+
+TEST(persistent_search_tree__methods, erase__all_versions) {
+	persistent_search_tree v0 = persistent_init;
+	std::vector<persistent_search_tree> versions = {v0};
+
+	for (value_type value : persistent_matcher) {
+		versions.push_back(versions.back().erase(value));
+	}
+
+	EXPECT_TRUE(versions.back().empty());
+	for (size_type i = 0; i < versions.size(); i++) {
+		EXPECT_EQ(versions[i].size(), persistent_matcher.size() - i);
+	}
+}
+
+TEST(persistent_search_tree__methods, snapshot__shares_every_node) {
+	counted_search_tree v0 = {3, 1, 2};
+	size_type before = allocated_nodes;
+
+	counted_search_tree v1 = v0.snapshot();
+
+	EXPECT_EQ(allocated_nodes, before);
+	EXPECT_EQ(v1, v0);
+}
+
+TEST(persistent_search_tree__methods, find) {
+	persistent_search_tree pst = persistent_init;
+
+	persistent_search_tree::const_iterator cit = pst.find(45);
+	ASSERT_NE(cit, pst.cend());
+	EXPECT_EQ(*cit, 45);
+	EXPECT_EQ(*++cit, 50);
+
+	EXPECT_EQ(pst.find(46), pst.cend());
+	EXPECT_THROW(static_cast<void>(*pst.cend()), std::runtime_error);
+}
+
+TEST(persistent_search_tree__destructor, releases_every_node) {
+	{
+		counted_search_tree v0;
+		std::vector<counted_search_tree> versions;
+
+		// Ascending insertions build a degenerate chain whose versions share most of their nodes
+		for (value_type value = 0; value < 2000; value++) {
+			v0 = v0.insert(value);
+			if (value % 100 == 0) {
+				versions.push_back(v0);
+			}
+		}
+
+		EXPECT_EQ(v0.size(), 2000);
+		EXPECT_EQ(versions[3].size(), 301);
+	}
+
+	EXPECT_EQ(allocated_nodes, 0);
+}
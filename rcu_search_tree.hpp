@@ -0,0 +1,204 @@
+#ifndef RCU_SEARCH_TREE_HPP
+#define RCU_SEARCH_TREE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "binary_search_tree.hpp"
+
+
+namespace adt {
+
+    // Publishes immutable versions of `Tree` through an atomic pointer. Readers register once per thread and then
+    // look up through load(), which is a single acquire load; they periodically call quiescent() to report that
+    // they hold no references into older versions. Writers build the next version off to the side, publish it, and
+    // free the previous one once every online reader has reported a quiescent state (QSBR)
+    template<class Tree>
+    class rcu_holder {
+    public:
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        using tree_type = Tree;
+
+        using size_type = std::size_t;
+
+    protected:
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        // Each reader owns one slot, on its own cache line, and is the only thread that writes to it
+        struct alignas(64) _ReaderSlot {
+            std::atomic<bool> claimed = false;
+
+            std::atomic<std::uint64_t> epoch = offline_epoch;
+        };
+
+        /* ------------------------------------------------Fields--------------------------------------------------- */
+        static constexpr std::uint64_t offline_epoch = std::numeric_limits<std::uint64_t>::max();
+
+        static constexpr size_type reader_slots = 64;
+
+        static_assert(std::atomic<const tree_type*>::is_always_lock_free,
+                      "adt::rcu_holder error: the published pointer must be loadable without a lock");
+
+        alignas(64) std::atomic<const tree_type*> current;
+
+        // Bumped once per published version; a reader whose slot shows this epoch holds no older version
+        alignas(64) std::atomic<std::uint64_t> epoch;
+
+        mutable _ReaderSlot readers[reader_slots];
+
+        std::mutex writer_mutex;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        void _synchronize(std::uint64_t target) const noexcept {
+            // Wait for every online reader to pass through a quiescent state after `target` was announced
+            for (const _ReaderSlot& slot : this->readers) {
+                std::uint64_t announced = slot.epoch.load(std::memory_order_seq_cst);
+                while (announced != offline_epoch && announced < target) {
+                    std::this_thread::yield();
+                    announced = slot.epoch.load(std::memory_order_seq_cst);
+                }
+            }
+        }
+
+        void _publish(const tree_type* next) noexcept {
+            const tree_type* previous = this->current.load(std::memory_order_relaxed);
+
+            // Publish the new version before announcing the new epoch, so a reader that sees the epoch sees it too
+            this->current.store(next, std::memory_order_seq_cst);
+            std::uint64_t target = this->epoch.fetch_add(1, std::memory_order_seq_cst) + 1;
+
+            this->_synchronize(target);
+            delete previous;
+        }
+
+    public:
+        /* ------------------------------------------------Reader--------------------------------------------------- */
+        class reader {
+        private:
+            /* --------------------------------------------Friends-------------------------------------------------- */
+            friend class rcu_holder;
+
+            /* ---------------------------------------------Fields-------------------------------------------------- */
+            const rcu_holder* holder;
+
+            _ReaderSlot* slot;
+
+            /* ------------------------------------------Constructors----------------------------------------------- */
+            reader(const rcu_holder* holder, _ReaderSlot* slot) noexcept : holder(holder), slot(slot) {
+                this->online();
+            }
+
+        public:
+            /* ------------------------------------------Constructors----------------------------------------------- */
+            reader(const reader& other) = delete;
+
+            reader(reader&& other) noexcept : holder(other.holder), slot(std::exchange(other.slot, nullptr)) {}
+
+            /* -------------------------------------------Destructor------------------------------------------------ */
+            ~reader() noexcept {
+                if (this->slot != nullptr) {
+                    this->offline();
+                    this->slot->claimed.store(false, std::memory_order_release);
+                }
+            }
+
+            /* --------------------------------------Overloaded Operators------------------------------------------- */
+            reader& operator=(const reader& rhs) = delete;
+
+            reader& operator=(reader&& rhs) = delete;
+
+            /* --------------------------------------------Methods-------------------------------------------------- */
+            [[nodiscard]] const tree_type& load() const noexcept {
+                // The entire read-side cost: no lock, and no store to memory shared with other threads
+                return *this->holder->current.load(std::memory_order_acquire);
+            }
+
+            void quiescent() noexcept {
+                // References obtained through load() before this call must no longer be used
+                this->slot->epoch.store(this->holder->epoch.load(std::memory_order_acquire),
+                                        std::memory_order_release);
+            }
+
+            void offline() noexcept { this->slot->epoch.store(offline_epoch, std::memory_order_release); }
+
+            void online() noexcept {
+                this->slot->epoch.store(this->holder->epoch.load(std::memory_order_seq_cst),
+                                        std::memory_order_seq_cst);
+
+                // Order the announcement before any load() that follows
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+            }
+        };
+
+        /* ---------------------------------------------Constructors------------------------------------------------ */
+        rcu_holder() : rcu_holder(tree_type()) {}
+
+        explicit rcu_holder(tree_type&& tree) : current(new tree_type(std::move(tree))), epoch(1) {}
+
+        rcu_holder(const rcu_holder& other) = delete;
+
+        rcu_holder(rcu_holder&& other) = delete;
+
+        /* -----------------------------------------------Destructor------------------------------------------------ */
+        ~rcu_holder() noexcept {
+            // No reader can outlive the holder
+            delete this->current.load(std::memory_order_relaxed);
+        }
+
+        /* ------------------------------------------Overloaded Operators------------------------------------------- */
+        rcu_holder& operator=(const rcu_holder& rhs) = delete;
+
+        rcu_holder& operator=(rcu_holder&& rhs) = delete;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        [[nodiscard]] reader register_reader() const {
+            for (_ReaderSlot& slot : this->readers) {
+                bool expected = false;
+                if (slot.claimed.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                    return reader(this, &slot);
+                }
+            }
+
+            throw std::length_error("adt::rcu_holder::register_reader() error: every reader slot is taken");
+        }
+
+        [[nodiscard]] std::uint64_t version() const noexcept { return this->epoch.load(std::memory_order_acquire); }
+
+        // The writes below wait for every online reader, so the calling thread's own reader, if it has one, must be
+        // offline
+        template<class Function>
+        void update(Function function) {
+            std::lock_guard<std::mutex> lock(this->writer_mutex);
+
+            // Copy the current version and modify the copy, which no reader can see yet
+            const tree_type& previous = *this->current.load(std::memory_order_relaxed);
+            std::unique_ptr<tree_type> next = std::make_unique<tree_type>(previous);
+            function(*next);
+
+            this->_publish(next.release());
+        }
+
+        void merge(tree_type&& delta) {
+            this->update([&delta](tree_type& next) { next.merge(delta); });
+        }
+
+        void publish(tree_type&& tree) {
+            std::unique_ptr<tree_type> next = std::make_unique<tree_type>(std::move(tree));
+            std::lock_guard<std::mutex> lock(this->writer_mutex);
+
+            this->_publish(next.release());
+        }
+    };
+
+    template<class T, class Allocator = std::allocator<T>>
+    using rcu_search_tree = rcu_holder<binary_search_tree<T, Allocator>>;
+} // adt
+
+
+#endif // RCU_SEARCH_TREE_HPP
@@ -0,0 +1,149 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "rcu_search_tree.hpp"
+
+/* --------------------------------------------Definitions--------------------------------------------------- */
+using value_type = int;
+
+using size_type = std::size_t;
+
+using binary_search_tree = adt::binary_search_tree<value_type>;
+
+using rcu_search_tree = adt::rcu_search_tree<value_type>;
+
+/* ---------------------------------------------Variables---------------------------------------------------- */
+constexpr std::initializer_list<value_type> rcu_init = {50, 30, 70, 20, 40, 60, 80, 10, 25, 35, 45, 55, 65};
+
+/* ----------------------------------------RCU Search Tree Tests--------------------------------------------- */
+TEST(rcu_search_tree__constructors, default_constructor) {
+	rcu_search_tree rcu;
+	rcu_search_tree::reader reader = rcu.register_reader();
+
+	EXPECT_TRUE(reader.load().empty());
+	EXPECT_EQ(rcu.version(), 1);
+}
+
+TEST(rcu_search_tree__constructors, tree_constructor) {
+	rcu_search_tree rcu{binary_search_tree(rcu_init)};
+	rcu_search_tree::reader reader = rcu.register_reader();
+
+	EXPECT_EQ(reader.load().size(), rcu_init.size());
+	EXPECT_TRUE(reader.load().contains(45));
+}
+
+TEST(rcu_search_tree__methods, update__publishes_a_new_version) {
+	rcu_search_tree rcu{binary_search_tree(rcu_init)};
+	rcu_search_tree::reader reader = rcu.register_reader();
+	const binary_search_tree* before = &reader.load();
+
+	// A thread's own reader has to be offline while it writes
+	reader.offline();
+	rcu.update([](binary_search_tree& next) { next.insert(42); });
+	reader.online();
+
+	EXPECT_NE(&reader.load(), before);
+	EXPECT_TRUE(reader.load().contains(42));
+	EXPECT_EQ(rcu.version(), 2);
+}
+
+TEST(rcu_search_tree__methods, merge_and_publish) {
+	rcu_search_tree rcu{binary_search_tree(rcu_init)};
+	rcu_search_tree::reader reader = rcu.register_reader();
+	reader.offline();
+
+	rcu.merge(binary_search_tree({1, 2, 3}));
+	reader.online();
+	EXPECT_EQ(reader.load().size(), rcu_init.size() + 3);
+	EXPECT_TRUE(reader.load().contains(2));
+
+	reader.offline();
+	rcu.publish(binary_search_tree({7}));
+	reader.online();
+	EXPECT_EQ(reader.load().size(), 1);
+	EXPECT_EQ(rcu.version(), 3);
+}
+
+TEST(rcu_search_tree__methods, update__waits_for_a_grace_period) {
+	rcu_search_tree rcu{binary_search_tree(rcu_init)};
+	rcu_search_tree::reader reader = rcu.register_reader();
+	std::atomic<bool> published = false;
+
+	// The reader holds a reference into the first version, so the writer cannot free it yet
+	const binary_search_tree& old_version = reader.load();
+	std::thread writer([&] {
+		rcu.update([](binary_search_tree& next) { next.clear(); });
+		published = true;
+	});
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	EXPECT_FALSE(published.load());
+	EXPECT_EQ(old_version.size(), rcu_init.size());
+	EXPECT_TRUE(old_version.contains(65));
+
+	// Once the reader is quiescent the writer finishes and the reader sees the new version
+	reader.quiescent();
+	writer.join();
+
+	EXPECT_TRUE(published.load());
+	EXPECT_TRUE(reader.load().empty());
+}
+
+TEST(rcu_search_tree__methods, register_reader__slots_are_reused) {
+	rcu_search_tree rcu;
+	std::vector<rcu_search_tree::reader> readers;
+
+	for (size_type i = 0; i < 64; i++) {
+		readers.push_back(rcu.register_reader());
+		readers.back().offline();
+	}
+	EXPECT_THROW(static_cast<void>(rcu.register_reader()), std::length_error);
+
+	readers.pop_back();
+	EXPECT_NO_THROW(static_cast<void>(rcu.register_reader()));
+}
+
+TEST(rcu_search_tree__methods, readers_with_concurrent_writer) {
+	rcu_search_tree rcu{binary_search_tree(rcu_init)};
+	rcu.update([](binary_search_tree& next) { next.insert(1000); });
+
+	std::atomic<bool> done = false;
+	std::atomic<size_type> inconsistent = 0;
+	std::vector<std::thread> readers;
+
+	for (size_type r = 0; r < 4; r++) {
+		readers.emplace_back([&] {
+			rcu_search_tree::reader reader = rcu.register_reader();
+
+			while (!done.load()) {
+				// Every version the writer publishes holds the initial values plus one extra value
+				const binary_search_tree& version = reader.load();
+				if (version.size() != rcu_init.size() + 1 || !version.contains(50)) {
+					inconsistent++;
+				}
+
+				reader.quiescent();
+			}
+		});
+	}
+
+	for (value_type value = 1001; value <= 1100; value++) {
+		rcu.update([value](binary_search_tree& next) {
+			next.erase(next.find(value - 1));
+			next.insert(value);
+		});
+	}
+
+	done = true;
+	for (std::thread& reader : readers) {
+		reader.join();
+	}
+
+	EXPECT_EQ(inconsistent.load(), 0);
+	EXPECT_EQ(rcu.version(), 102);
+}
@@ -0,0 +1,236 @@
+#ifndef SEARCH_TREE_MAP_HPP
+#define SEARCH_TREE_MAP_HPP
+
+#include <cstddef>
+#include <memory>
+#include <initializer_list>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "binary_search_tree.hpp"
+
+
+namespace adt {
+
+    // A key-value pair ordered by its key alone, so a BST of entries behaves as a map. Two entries are equal only
+    // when their mapped values are equal too; lookups match entries through the ordering, which is by key
+    template<class Key, class T>
+    struct map_entry : std::pair<const Key, T> {
+        using std::pair<const Key, T>::pair;
+
+        [[nodiscard]] friend constexpr bool operator==(const map_entry& lhs, const map_entry& rhs) {
+            return lhs.first == rhs.first && lhs.second == rhs.second;
+        }
+
+        [[nodiscard]] friend constexpr bool operator<(const map_entry& lhs, const map_entry& rhs) {
+            return lhs.first < rhs.first;
+        }
+
+        [[nodiscard]] friend constexpr bool operator>(const map_entry& lhs, const map_entry& rhs) {
+            return rhs.first < lhs.first;
+        }
+
+        [[nodiscard]] friend constexpr bool operator<=(const map_entry& lhs, const map_entry& rhs) {
+            return !(rhs.first < lhs.first);
+        }
+
+        [[nodiscard]] friend constexpr bool operator>=(const map_entry& lhs, const map_entry& rhs) {
+            return !(lhs.first < rhs.first);
+        }
+    };
+
+    // An ordered map on top of binary_search_tree, sharing its node layout, removal and iterators. Lookups descend
+    // by key, and a mapped value is constructed in its node only when its key is absent
+    template<class Key, class T, class Allocator = std::allocator<map_entry<Key, T>>>
+    class search_tree_map : public binary_search_tree<map_entry<Key, T>, Allocator> {
+    public:
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        using tree_type = binary_search_tree<map_entry<Key, T>, Allocator>;
+
+        using key_type = Key;
+
+        using mapped_type = T;
+
+        using value_type = typename tree_type::value_type;
+
+        using allocator_type = typename tree_type::allocator_type;
+
+        using size_type = typename tree_type::size_type;
+
+        using const_reference = typename tree_type::const_reference;
+
+        using iterator = typename tree_type::iterator;
+
+        using const_iterator = typename tree_type::const_iterator;
+
+        using node_type = typename tree_type::node_type;
+
+    protected:
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        using _Node = typename tree_type::_Node;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        _Node* _find_key(const key_type& key) const noexcept {
+            _Node* curr = this->root;
+            while (curr != nullptr) {
+                if (key < curr->value.first) {
+                    curr = curr->left;
+                } else if (curr->value.first < key) {
+                    curr = curr->right;
+                } else {
+                    return curr;
+                }
+            }
+
+            return nullptr;
+        }
+
+        template<class K, class... Args>
+        std::pair<_Node*, bool> _try_emplace(K&& key, Args&&... args) {
+            // Descend to the key's node, or to the leaf position where it belongs
+            _Node* parent = nullptr;
+            bool left = false;
+            for (_Node* curr = this->root; curr != nullptr;) {
+                parent = curr;
+                if (key < curr->value.first) {
+                    left = true;
+                    curr = curr->left;
+                } else if (curr->value.first < key) {
+                    left = false;
+                    curr = curr->right;
+                } else {
+                    // The key is present, so nothing is allocated and `args` are left untouched
+                    return std::make_pair(curr, false);
+                }
+            }
+
+            _Node* node = this->_construct_in_place(parent, std::piecewise_construct,
+                                                    std::forward_as_tuple(std::forward<K>(key)),
+                                                    std::forward_as_tuple(std::forward<Args>(args)...));
+            this->_attach(node, parent, left);
+
+            return std::make_pair(node, true);
+        }
+
+        template<class K, class M>
+        std::pair<iterator, bool> _insert_or_assign(K&& key, M&& mapped) {
+            if (_Node* node = this->_find_key(key); node != nullptr) {
+                node->value.second = std::forward<M>(mapped);
+                return std::make_pair(this->_make_iterator(node), false);
+            }
+
+            std::pair<_Node*, bool> pair = this->_try_emplace(std::forward<K>(key), std::forward<M>(mapped));
+            return std::make_pair(this->_make_iterator(pair.first), true);
+        }
+
+    public:
+        /* ---------------------------------------------Constructors------------------------------------------------ */
+        search_tree_map() noexcept : tree_type() {}
+
+        explicit search_tree_map(const allocator_type& allocator) noexcept : tree_type(allocator) {}
+
+        search_tree_map(std::initializer_list<value_type> values) : tree_type() {
+            // Like std::map, the first entry for a key wins
+            for (const_reference value : values) {
+                this->_try_emplace(value.first, value.second);
+            }
+        }
+
+        search_tree_map(const search_tree_map& other) = default;
+
+        search_tree_map(search_tree_map&& other) noexcept = default;
+
+        /* -----------------------------------------------Destructor------------------------------------------------ */
+        virtual ~search_tree_map() noexcept override = default;
+
+        /* ------------------------------------------Overloaded Operators------------------------------------------- */
+        search_tree_map& operator=(const search_tree_map& rhs) = default;
+
+        search_tree_map& operator=(search_tree_map&& rhs) noexcept = default;
+
+        mapped_type& operator[](const key_type& key) { return this->_try_emplace(key).first->value.second; }
+
+        mapped_type& operator[](key_type&& key) { return this->_try_emplace(std::move(key)).first->value.second; }
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        using tree_type::erase;
+
+        using tree_type::extract;
+
+        [[nodiscard]] mapped_type& at(const key_type& key) {
+            _Node* node = this->_find_key(key);
+            if (node == nullptr) {
+                throw std::out_of_range("adt::search_tree_map::at() error: key not found");
+            }
+
+            return node->value.second;
+        }
+
+        [[nodiscard]] const mapped_type& at(const key_type& key) const {
+            _Node* node = this->_find_key(key);
+            if (node == nullptr) {
+                throw std::out_of_range("adt::search_tree_map::at() error: key not found");
+            }
+
+            return node->value.second;
+        }
+
+        template<class... Args>
+        std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args) {
+            std::pair<_Node*, bool> pair = this->_try_emplace(key, std::forward<Args>(args)...);
+            return std::make_pair(this->_make_iterator(pair.first), pair.second);
+        }
+
+        template<class... Args>
+        std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args) {
+            std::pair<_Node*, bool> pair = this->_try_emplace(std::move(key), std::forward<Args>(args)...);
+            return std::make_pair(this->_make_iterator(pair.first), pair.second);
+        }
+
+        template<class M>
+        std::pair<iterator, bool> insert_or_assign(const key_type& key, M&& mapped) {
+            return this->_insert_or_assign(key, std::forward<M>(mapped));
+        }
+
+        template<class M>
+        std::pair<iterator, bool> insert_or_assign(key_type&& key, M&& mapped) {
+            return this->_insert_or_assign(std::move(key), std::forward<M>(mapped));
+        }
+
+        [[nodiscard]] iterator find(const key_type& key) noexcept {
+            return this->_make_iterator(this->_find_key(key));
+        }
+
+        [[nodiscard]] const_iterator find(const key_type& key) const noexcept {
+            return this->_make_const_iterator(this->_find_key(key));
+        }
+
+        [[nodiscard]] bool contains(const key_type& key) const noexcept { return this->_find_key(key) != nullptr; }
+
+        [[nodiscard]] virtual bool contains(const_reference value) const noexcept override {
+            return this->contains(value.first);
+        }
+
+        [[nodiscard]] size_type count(const key_type& key) const noexcept { return this->contains(key) ? 1 : 0; }
+
+        size_type erase(const key_type& key) noexcept {
+            _Node* node = this->_find_key(key);
+            if (node == nullptr) {
+                return 0;
+            }
+
+            this->_erase(node);
+            return 1;
+        }
+
+        node_type extract(const key_type& key) noexcept {
+            // The node leaves the map with its entry intact, so reinserting it allocates nothing
+            _Node* node = this->_find_key(key);
+            return (node != nullptr) ? tree_type::extract(this->_make_const_iterator(node)) : node_type();
+        }
+    };
+} // adt
+
+
+#endif // SEARCH_TREE_MAP_HPP
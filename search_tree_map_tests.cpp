@@ -0,0 +1,181 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "search_tree_map.hpp"
+
+/* --------------------------------------------Definitions--------------------------------------------------- */
+using key_type = int;
+
+using size_type = std::size_t;
+
+using search_tree_map = adt::search_tree_map<key_type, std::string>;
+
+struct counted_value {
+	static inline size_type constructions = 0;
+
+	int value;
+
+	explicit counted_value(int value = 0) : value(value) { constructions++; }
+
+	counted_value(const counted_value& other) : value(other.value) { constructions++; }
+
+	counted_value(counted_value&& other) noexcept : value(other.value) { constructions++; }
+
+	counted_value& operator=(const counted_value& rhs) = default;
+
+	counted_value& operator=(counted_value&& rhs) noexcept = default;
+};
+
+/* ---------------------------------------------Variables---------------------------------------------------- */
+const std::vector<std::pair<key_type, std::string>> map_matcher = {
+	{10, "ten"}, {20, "twenty"}, {30, "thirty"}, {40, "forty"}, {50, "fifty"}
+};
+
+/* ---------------------------------------Search Tree Map Tests---------------------------------------------- */
+TEST(search_tree_map__constructors, default_constructor) {
+	search_tree_map map;
+
+	EXPECT_TRUE(map.empty());
+	EXPECT_EQ(map.find(10), map.end());
+	EXPECT_FALSE(map.contains(10));
+	EXPECT_THROW(static_cast<void>(map.at(10)), std::out_of_range);
+}
+
+TEST(search_tree_map__constructors, initializer_list_constructor) {
+	search_tree_map map = {{30, "thirty"}, {10, "ten"}, {50, "fifty"}, {20, "twenty"}, {40, "forty"}, {10, "TEN"}};
+
+	// Entries come out ordered by key, and the first entry for a repeated key is kept
+	EXPECT_EQ(map.size(), map_matcher.size());
+	EXPECT_TRUE(std::equal(map.cbegin(), map.cend(), map_matcher.begin(), map_matcher.end(),
+						   [](const auto& entry, const auto& pair) {
+							   return entry.first == pair.first && entry.second == pair.second;
+						   }));
+	EXPECT_EQ(map.at(10), "ten");
+}
+
+TEST(search_tree_map__methods, operator_subscript) {
+	search_tree_map map;
+
+	map[20] = "twenty";
+	map[10] = "ten";
+	map[20] += "!";
+
+	EXPECT_EQ(map.size(), 2);
+	EXPECT_EQ(map[20], "twenty!");
+	EXPECT_EQ(map[30], "");
+	EXPECT_EQ(map.size(), 3);
+	EXPECT_EQ(map.peek_min().second, "ten");
+	EXPECT_EQ(map.peek_max().first, 30);
+}
+
+TEST(search_tree_map__methods, try_emplace__only_when_absent) {
+	adt::search_tree_map<key_type, counted_value> map;
+	counted_value::constructions = 0;
+
+	auto [it, inserted] = map.try_emplace(1, 100);
+	EXPECT_TRUE(inserted);
+	EXPECT_EQ(it->second.value, 100);
+	EXPECT_EQ(counted_value::constructions, 1);
+
+	// A present key neither constructs a mapped value nor touches the arguments
+	std::tie(it, inserted) = map.try_emplace(1, 200);
+	EXPECT_FALSE(inserted);
+	EXPECT_EQ(it->second.value, 100);
+	map[1].value++;
+	EXPECT_EQ(map.at(1).value, 101);
+	EXPECT_EQ(counted_value::constructions, 1);
+
+	std::string moved_from = "kept";
+	adt::search_tree_map<key_type, std::string> strings = {{1, "one"}};
+	strings.try_emplace(1, std::move(moved_from));
+	EXPECT_EQ(moved_from, "kept");
+}
+
+TEST(search_tree_map__methods, insert_or_assign) {
+	search_tree_map map = {{10, "ten"}};
+
+	auto [it, inserted] = map.insert_or_assign(10, "TEN");
+	EXPECT_FALSE(inserted);
+	EXPECT_EQ(it->second, "TEN");
+
+	std::tie(it, inserted) = map.insert_or_assign(5, "five");
+	EXPECT_TRUE(inserted);
+	EXPECT_EQ(it->first, 5);
+	EXPECT_EQ(map.peek_min().second, "five");
+	EXPECT_EQ(map.size(), 2);
+}
+
+TEST(search_tree_map__methods, erase_and_extract) {
+	search_tree_map map = {{30, "thirty"}, {10, "ten"}, {50, "fifty"}, {20, "twenty"}, {40, "forty"}};
+
+	EXPECT_EQ(map.erase(30), 1);
+	EXPECT_EQ(map.erase(30), 0);
+	EXPECT_FALSE(map.contains(30));
+
+	search_tree_map::node_type node = map.extract(50);
+	ASSERT_FALSE(node.empty());
+	EXPECT_EQ(node.value().first, 50);
+	EXPECT_EQ(node.value().second, "fifty");
+	EXPECT_EQ(map.size(), 3);
+	EXPECT_EQ(map.peek_max().first, 40);
+	EXPECT_TRUE(map.extract(50).empty());
+
+	map.erase(map.find(10));
+	EXPECT_EQ(map.peek_min().first, 20);
+}
+
+TEST(search_tree_map__methods, equality__compares_mapped_values) {
+	adt::search_tree_map<key_type, int> lhs = {{1, 2}, {3, 4}};
+	adt::search_tree_map<key_type, int> rhs = {{1, 2}, {3, 4}};
+
+	EXPECT_EQ(lhs, rhs);
+
+	// Equal keys with different mapped values make different maps
+	rhs[1] = 3;
+	EXPECT_NE(lhs, rhs);
+	EXPECT_NE(*lhs.cbegin(), *rhs.cbegin());
+
+	// Inserting an entry still matches an existing entry by its key alone
+	auto [it, inserted] = lhs.insert(adt::map_entry<key_type, int>(3, 5));
+	EXPECT_FALSE(inserted);
+	EXPECT_EQ(it->second, 4);
+	EXPECT_EQ(lhs.size(), 2);
+	EXPECT_TRUE(lhs.contains(adt::map_entry<key_type, int>(1, 7)));
+}
+
+TEST(search_tree_map__methods, randomized_against_std_map) {
+	adt::search_tree_map<key_type, int> map;
+	std::map<key_type, int> matcher;
+	std::mt19937 rng(12345);
+
+	for (size_type i = 0; i < 20000; i++) {
+		key_type key = static_cast<key_type>(rng() % 1000);
+		switch (rng() % 4) {
+			case 0:
+				map[key]++;
+				matcher[key]++;
+				break;
+			case 1:
+				map.insert_or_assign(key, static_cast<int>(i));
+				matcher.insert_or_assign(key, static_cast<int>(i));
+				break;
+			case 2:
+				map.try_emplace(key, -static_cast<int>(i));
+				matcher.try_emplace(key, -static_cast<int>(i));
+				break;
+			default:
+				ASSERT_EQ(map.erase(key), matcher.erase(key)) << i;
+		}
+	}
+
+	ASSERT_EQ(map.size(), matcher.size());
+	EXPECT_TRUE(std::equal(map.cbegin(), map.cend(), matcher.begin(), matcher.end(),
+						   [](const auto& entry, const auto& pair) {
+							   return entry.first == pair.first && entry.second == pair.second;
+						   }));
+}
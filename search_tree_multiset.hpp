@@ -0,0 +1,335 @@
+#ifndef SEARCH_TREE_MULTISET_HPP
+#define SEARCH_TREE_MULTISET_HPP
+
+#include <cstddef>
+#include <memory>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "binary_search_tree.hpp"
+#include "search_tree_map.hpp"
+
+
+namespace adt {
+
+    // Extracts the key a map_entry is ordered by
+    struct map_entry_key {
+        template<class Key, class T>
+        [[nodiscard]] constexpr const Key& operator()(const map_entry<Key, T>& entry) const noexcept {
+            return entry.first;
+        }
+    };
+
+    // A binary_search_tree that keeps equal keys. A new value is placed after every value with an equal key, so
+    // each run of equal keys stays in insertion order and is contiguous in the in-order sequence. Without subtree
+    // counts in the nodes, count(), equal_range() and erase() by key take O(log n + k) for a run of k values
+    template<class T, class Allocator = std::allocator<T>, class KeyOf = std::identity>
+    class search_tree_multiset : public binary_search_tree<T, Allocator> {
+    public:
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        using tree_type = binary_search_tree<T, Allocator>;
+
+        using key_type = std::remove_cvref_t<std::invoke_result_t<KeyOf, const T&>>;
+
+        using value_type = typename tree_type::value_type;
+
+        using allocator_type = typename tree_type::allocator_type;
+
+        using size_type = typename tree_type::size_type;
+
+        using const_reference = typename tree_type::const_reference;
+
+        using iterator = typename tree_type::iterator;
+
+        using const_iterator = typename tree_type::const_iterator;
+
+    protected:
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        using _Node = typename tree_type::_Node;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        static constexpr const key_type& _key(const _Node* node) noexcept { return KeyOf()(node->value); }
+
+        _Node* _lower_bound(const key_type& key) const noexcept {
+            // The leftmost node whose key is not less than `key`
+            _Node* bound = nullptr;
+            for (_Node* curr = this->root; curr != nullptr;) {
+                if (_key(curr) < key) {
+                    curr = curr->right;
+                } else {
+                    bound = curr;
+                    curr = curr->left;
+                }
+            }
+
+            return bound;
+        }
+
+        _Node* _upper_bound(const key_type& key) const noexcept {
+            // The leftmost node whose key is greater than `key`
+            _Node* bound = nullptr;
+            for (_Node* curr = this->root; curr != nullptr;) {
+                if (key < _key(curr)) {
+                    bound = curr;
+                    curr = curr->left;
+                } else {
+                    curr = curr->right;
+                }
+            }
+
+            return bound;
+        }
+
+        bool _contains(const key_type& key) const noexcept {
+            _Node* node = this->_lower_bound(key);
+            return node != nullptr && !(key < _key(node));
+        }
+
+        void _link(_Node* node) noexcept {
+            const key_type& key = _key(node);
+
+            // Keys at or past either end attach to the cached extremes, so ascending keys (such as timestamps) go in
+            // in O(1); ties go after the maximum, and only strictly smaller keys go before the minimum
+            _Node* parent = nullptr;
+            bool left = false;
+            if (this->root != nullptr && !(key < _key(this->max_node))) {
+                parent = this->max_node;
+            } else if (this->root != nullptr && key < _key(this->min_node)) {
+                parent = this->min_node;
+                left = true;
+            } else {
+                // Equal keys descend to the right, which places the new value after them
+                for (_Node* curr = this->root; curr != nullptr;) {
+                    parent = curr;
+                    left = key < _key(curr);
+                    curr = left ? curr->left : curr->right;
+                }
+            }
+
+            node->parent = parent;
+            this->_attach(node, parent, left);
+        }
+
+        template<class... Args>
+        _Node* _emplace(Args&&... args) {
+            _Node* node = this->_construct_in_place(nullptr, std::forward<Args>(args)...);
+            this->_link(node);
+
+            return node;
+        }
+
+        void _merge(search_tree_multiset& source) noexcept {
+            if (&source == this) {
+                return;
+            }
+
+            // Take the source's nodes in order, then empty it before relinking them here; nothing is allocated
+            // or copied, and equal keys keep their relative order after the ones already present
+            std::vector<_Node*> nodes;
+            nodes.reserve(source.sz);
+            for (_Node* curr = source.min_node; curr != nullptr; curr = tree_type::_inorder_forward_traverse(curr)) {
+                nodes.push_back(curr);
+            }
+
+            source._forget_all();
+            source.root = source.min_node = source.max_node = nullptr;
+            source.sz = 0;
+
+            for (_Node* node : nodes) {
+                node->parent = node->left = node->right = nullptr;
+                this->_link(node);
+            }
+        }
+
+    public:
+        /* ---------------------------------------------Constructors------------------------------------------------ */
+        search_tree_multiset() noexcept : tree_type() {}
+
+        explicit search_tree_multiset(const allocator_type& allocator) noexcept : tree_type(allocator) {}
+
+        search_tree_multiset(std::initializer_list<value_type> values) : tree_type() { this->insert(values); }
+
+        search_tree_multiset(const search_tree_multiset& other) = default;
+
+        search_tree_multiset(search_tree_multiset&& other) noexcept = default;
+
+        /* -----------------------------------------------Destructor------------------------------------------------ */
+        virtual ~search_tree_multiset() noexcept override = default;
+
+        /* ------------------------------------------Overloaded Operators------------------------------------------- */
+        search_tree_multiset& operator=(const search_tree_multiset& rhs) = default;
+
+        search_tree_multiset& operator=(search_tree_multiset&& rhs) noexcept = default;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        using tree_type::erase;
+
+        iterator insert(const_reference value) { return this->_make_iterator(this->_emplace(value)); }
+
+        iterator insert(value_type&& value) { return this->_make_iterator(this->_emplace(std::move(value))); }
+
+        virtual void insert(std::initializer_list<value_type> values) noexcept override {
+            for (const_reference value : values) {
+                this->_emplace(value);
+            }
+        }
+
+        template<class... Args>
+        iterator emplace(Args&&... args) {
+            return this->_make_iterator(this->_emplace(std::forward<Args>(args)...));
+        }
+
+        // Equal keys must stay in insertion order, so the value always goes after every equal key and the hint
+        // is not used
+        template<class... Args>
+        iterator emplace_hint(const_iterator, Args&&... args) {
+            return this->_make_iterator(this->_emplace(std::forward<Args>(args)...));
+        }
+
+        template<std::input_iterator InputIt>
+        size_type append_sorted(InputIt first, InputIt last) {
+            // Keys at or past the maximum take _emplace()'s O(1) path, and nothing is dropped as a duplicate
+            size_type inserted = 0;
+            for (; first != last; ++first, inserted++) {
+                this->_emplace(*first);
+            }
+
+            return inserted;
+        }
+
+        template<class R>
+        void insert_range(R&& range) requires(std::ranges::input_range<R>) {
+            for (auto&& value : range) {
+                this->_emplace(std::forward<decltype(value)>(value));
+            }
+        }
+
+        void merge(search_tree_multiset& source) noexcept { this->_merge(source); }
+
+        void merge(search_tree_multiset&& source) noexcept { this->_merge(source); }
+
+        // Merging from a unique-key BST would go through its duplicate-dropping insertion
+        void merge(tree_type& source) = delete;
+
+        void merge(tree_type&& source) = delete;
+
+        [[nodiscard]] iterator find(const key_type& key) noexcept {
+            // The first value with an equal key
+            _Node* node = this->_lower_bound(key);
+            return this->_make_iterator((node != nullptr && !(key < _key(node))) ? node : nullptr);
+        }
+
+        [[nodiscard]] const_iterator find(const key_type& key) const noexcept {
+            _Node* node = this->_lower_bound(key);
+            return this->_make_const_iterator((node != nullptr && !(key < _key(node))) ? node : nullptr);
+        }
+
+        [[nodiscard]] virtual bool contains(const_reference value) const noexcept override {
+            return this->_contains(KeyOf()(value));
+        }
+
+        // A separate lookup by key only where keys and values differ, as they do in a multimap
+        template<class K = key_type> requires(!std::is_same_v<K, value_type>)
+        [[nodiscard]] bool contains(const key_type& key) const noexcept {
+            return this->_contains(key);
+        }
+
+        [[nodiscard]] size_type count(const key_type& key) const noexcept {
+            // Find the start of the run, then walk it
+            size_type count = 0;
+            for (_Node* curr = this->_lower_bound(key); curr != nullptr && !(key < _key(curr));
+                 curr = tree_type::_find_successor(curr)) {
+                count++;
+            }
+
+            return count;
+        }
+
+        [[nodiscard]] iterator lower_bound(const key_type& key) noexcept {
+            return this->_make_iterator(this->_lower_bound(key));
+        }
+
+        [[nodiscard]] const_iterator lower_bound(const key_type& key) const noexcept {
+            return this->_make_const_iterator(this->_lower_bound(key));
+        }
+
+        [[nodiscard]] iterator upper_bound(const key_type& key) noexcept {
+            return this->_make_iterator(this->_upper_bound(key));
+        }
+
+        [[nodiscard]] const_iterator upper_bound(const key_type& key) const noexcept {
+            return this->_make_const_iterator(this->_upper_bound(key));
+        }
+
+        [[nodiscard]] std::pair<iterator, iterator> equal_range(const key_type& key) noexcept {
+            return std::make_pair(this->lower_bound(key), this->upper_bound(key));
+        }
+
+        [[nodiscard]] std::pair<const_iterator, const_iterator> equal_range(const key_type& key) const noexcept {
+            return std::make_pair(this->lower_bound(key), this->upper_bound(key));
+        }
+
+        iterator erase(iterator first, iterator last) { return this->erase(const_iterator(first), const_iterator(last)); }
+
+        iterator erase(const_iterator first, const_iterator last) {
+            // binary_search_tree splits the range off by key, which cannot tell apart the values in a run of equal
+            // keys, so unlink the range one node at a time instead
+            _Node* curr = tree_type::_node_of(first);
+            _Node* end = tree_type::_node_of(last);
+            if (curr == nullptr && end != nullptr) {
+                throw std::invalid_argument("adt::search_tree_multiset::erase() error: \"last\" must be reachable from \"first\"");
+            }
+
+            // Keys alone order the endpoints unless both sit in the same run, which has to be walked
+            if (curr != nullptr && end != nullptr && !(_key(curr) < _key(end))) {
+                _Node* node = curr;
+                while (node != nullptr && node != end && !(_key(end) < _key(node))) {
+                    node = tree_type::_find_successor(node);
+                }
+
+                if (node != end) {
+                    throw std::invalid_argument("adt::search_tree_multiset::erase() error: \"last\" must be reachable from \"first\"");
+                }
+            }
+
+            // Each successor is found before its predecessor goes, and nodes never move, so it stays valid
+            while (curr != end) {
+                _Node* next = tree_type::_find_successor(curr);
+                this->_erase(curr);
+                curr = next;
+            }
+
+            return this->_make_iterator(end);
+        }
+
+        // A multimap entry is erased through its key or an iterator; erasing by a whole entry would have to pick
+        // between entries that share a key
+        size_type erase(const_reference value) requires(!std::is_same_v<key_type, value_type>) = delete;
+
+        size_type erase(const key_type& key) noexcept {
+            // Remove the run one node at a time; nodes never move, so each successor is found before its
+            // predecessor goes and stays valid afterwards
+            size_type count = 0;
+            for (_Node* curr = this->_lower_bound(key); curr != nullptr && !(key < _key(curr)); count++) {
+                _Node* next = tree_type::_find_successor(curr);
+                this->_erase(curr);
+                curr = next;
+            }
+
+            return count;
+        }
+    };
+
+    // A multimap ordered by key, which keeps the mapped values of equal keys in insertion order
+    template<class Key, class T, class Allocator = std::allocator<map_entry<Key, T>>>
+    using search_tree_multimap = search_tree_multiset<map_entry<Key, T>, Allocator, map_entry_key>;
+} // adt
+
+
+#endif // SEARCH_TREE_MULTISET_HPP
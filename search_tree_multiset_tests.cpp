@@ -0,0 +1,225 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "search_tree_multiset.hpp"
+
+/* --------------------------------------------Definitions--------------------------------------------------- */
+using value_type = int;
+
+using size_type = std::size_t;
+
+using search_tree_multiset = adt::search_tree_multiset<value_type>;
+
+using search_tree_multimap = adt::search_tree_multimap<value_type, std::string>;
+
+/* ---------------------------------------------Variables---------------------------------------------------- */
+constexpr std::initializer_list<value_type> multiset_init = {50, 30, 70, 30, 50, 20, 50, 80, 20};
+
+constexpr std::initializer_list<value_type> multiset_matcher = {20, 20, 30, 30, 50, 50, 50, 70, 80};
+
+/* ------------------------------------Search Tree Multiset Tests-------------------------------------------- */
+TEST(search_tree_multiset__constructors, initializer_list_constructor) {
+	search_tree_multiset mst = multiset_init;
+
+	EXPECT_EQ(mst.size(), multiset_matcher.size());
+	EXPECT_TRUE(std::equal(mst.cbegin(), mst.cend(), multiset_matcher.begin(), multiset_matcher.end()));
+	EXPECT_EQ(mst.peek_min(), 20);
+	EXPECT_EQ(mst.peek_max(), 80);
+}
+
+TEST(search_tree_multiset__methods, count_and_equal_range) {
+	search_tree_multiset mst = multiset_init;
+
+	EXPECT_EQ(mst.count(50), 3);
+	EXPECT_EQ(mst.count(20), 2);
+	EXPECT_EQ(mst.count(80), 1);
+	EXPECT_EQ(mst.count(60), 0);
+	EXPECT_TRUE(mst.contains(30));
+	EXPECT_FALSE(mst.contains(31));
+
+	auto [first, last] = mst.equal_range(50);
+	EXPECT_EQ(std::distance(first, last), 3);
+	EXPECT_EQ(*last, 70);
+
+	// An empty range sits where the key would go
+	std::tie(first, last) = mst.equal_range(60);
+	EXPECT_EQ(first, last);
+	EXPECT_EQ(*first, 70);
+
+	std::tie(first, last) = mst.equal_range(80);
+	EXPECT_EQ(last, mst.end());
+}
+
+TEST(search_tree_multiset__methods, erase__whole_run) {
+	search_tree_multiset mst = multiset_init;
+
+	EXPECT_EQ(mst.erase(50), 3);
+	EXPECT_EQ(mst.erase(50), 0);
+	EXPECT_EQ(mst.erase(20), 2);
+
+	std::vector<value_type> matcher = {30, 30, 70, 80};
+	EXPECT_EQ(mst.size(), matcher.size());
+	EXPECT_TRUE(std::equal(mst.cbegin(), mst.cend(), matcher.begin(), matcher.end()));
+	EXPECT_EQ(mst.peek_min(), 30);
+}
+
+TEST(search_tree_multiset__methods, erase__range_inside_a_run) {
+	search_tree_multiset mst = {1, 1, 1, 2};
+
+	// A range that starts after the first of several equal keys leaves that first one
+	search_tree_multiset::iterator it = mst.erase(std::next(mst.cbegin()), mst.cend());
+	EXPECT_EQ(it, mst.end());
+	EXPECT_THAT(std::vector<value_type>(mst.cbegin(), mst.cend()), ::testing::ElementsAre(1));
+	EXPECT_EQ(mst.peek_max(), 1);
+
+	// A range that ends inside a run erases only the values before its end
+	mst = {1, 2, 2, 2, 3};
+	it = mst.erase(std::next(mst.cbegin()), std::next(mst.cbegin(), 2));
+	EXPECT_EQ(*it, 2);
+	EXPECT_THAT(std::vector<value_type>(mst.cbegin(), mst.cend()), ::testing::ElementsAre(1, 2, 2, 3));
+
+	// Both ends inside the same run
+	mst = {5, 5, 5, 5};
+	it = mst.erase(std::next(mst.cbegin()), std::next(mst.cbegin(), 3));
+	EXPECT_EQ(it, std::next(mst.begin()));
+	EXPECT_EQ(mst.size(), 2);
+
+	// An empty range erases nothing, and a reversed one inside a run is rejected before anything is erased
+	EXPECT_EQ(mst.erase(mst.cbegin(), mst.cbegin()), mst.begin());
+	EXPECT_THROW(mst.erase(std::next(mst.cbegin()), mst.cbegin()), std::invalid_argument);
+	EXPECT_EQ(mst.size(), 2);
+}
+
+TEST(search_tree_multiset__methods, erase__range_against_std_multiset) {
+	std::mt19937 rng(12345);
+
+	// Few distinct keys, so most endpoints fall inside runs
+	for (size_type round = 0; round < 200; round++) {
+		search_tree_multiset mst;
+		std::multiset<value_type> matcher;
+		for (size_type i = 0; i < 40; i++) {
+			value_type value = static_cast<value_type>(rng() % 5);
+			mst.insert(value);
+			matcher.insert(value);
+		}
+
+		size_type first = rng() % 41;
+		size_type last = first + rng() % (41 - first);
+		mst.erase(std::next(mst.cbegin(), first), std::next(mst.cbegin(), last));
+		matcher.erase(std::next(matcher.begin(), first), std::next(matcher.begin(), last));
+
+		ASSERT_EQ(mst.size(), matcher.size());
+		ASSERT_TRUE(std::equal(mst.cbegin(), mst.cend(), matcher.begin(), matcher.end()));
+		if (!matcher.empty()) {
+			ASSERT_EQ(mst.peek_min(), *matcher.begin());
+			ASSERT_EQ(mst.peek_max(), *matcher.rbegin());
+		}
+	}
+}
+
+TEST(search_tree_multiset__methods, emplace_hint__keeps_duplicates) {
+	search_tree_multiset mst = {1, 2, 2, 3};
+
+	mst.emplace_hint(mst.cbegin(), 2);
+	mst.emplace_hint(mst.cend(), 0);
+
+	EXPECT_EQ(mst.count(2), 3);
+	EXPECT_EQ(mst.size(), 6);
+	EXPECT_EQ(mst.peek_min(), 0);
+}
+
+TEST(search_tree_multiset__methods, merge__relinks_duplicates) {
+	search_tree_multimap dst;
+	search_tree_multimap src;
+	dst.emplace(2, "dst");
+	src.emplace(2, "src first");
+	src.emplace(2, "src second");
+	src.emplace(4, "src");
+
+	dst.merge(src);
+
+	// Every entry moves over, and the source's equal keys follow the destination's in their own order
+	std::vector<std::string> at_2;
+	for (auto [it, last] = dst.equal_range(2); it != last; ++it) {
+		at_2.push_back(it->second);
+	}
+
+	EXPECT_THAT(at_2, ::testing::ElementsAre("dst", "src first", "src second"));
+	EXPECT_EQ(dst.size(), 4);
+	EXPECT_EQ(dst.peek_max().second, "src");
+	EXPECT_TRUE(src.empty());
+	EXPECT_FALSE(src.contains(2));
+
+	src.emplace(1, "reused");
+	EXPECT_EQ(src.size(), 1);
+}
+
+TEST(search_tree_multiset__methods, append_sorted_and_insert_range__keep_duplicates) {
+	search_tree_multiset mst = {1, 2, 2, 3};
+	std::vector<value_type> sorted = {3, 3, 4, 4, 5};
+	std::vector<value_type> unsorted = {2, 0, 5, 2};
+
+	EXPECT_EQ(mst.append_sorted(sorted.begin(), sorted.end()), sorted.size());
+	mst.insert_range(unsorted);
+	mst.push_back_unchecked(5);
+
+	std::vector<value_type> matcher = {0, 1, 2, 2, 2, 2, 3, 3, 3, 4, 4, 5, 5, 5};
+	EXPECT_EQ(mst.size(), matcher.size());
+	EXPECT_TRUE(std::equal(mst.cbegin(), mst.cend(), matcher.begin(), matcher.end()));
+	EXPECT_EQ(mst.count(5), 3);
+}
+
+TEST(search_tree_multiset__methods, multimap__insertion_order_within_a_key) {
+	search_tree_multimap events;
+
+	// Timestamps arrive mostly in order, with repeats
+	events.emplace(100, "open");
+	events.emplace(105, "read");
+	events.emplace(100, "stat");
+	events.emplace(105, "write");
+	events.emplace(90, "lookup");
+	events.emplace(105, "close");
+
+	std::vector<std::string> at_105;
+	for (auto [it, last] = events.equal_range(105); it != last; ++it) {
+		at_105.push_back(it->second);
+	}
+
+	EXPECT_THAT(at_105, ::testing::ElementsAre("read", "write", "close"));
+	EXPECT_EQ(events.count(100), 2);
+	EXPECT_EQ(events.find(100)->second, "open");
+	EXPECT_TRUE(events.contains(90));
+	EXPECT_EQ(events.peek_min().second, "lookup");
+	EXPECT_EQ(events.peek_max().second, "close");
+}
+
+TEST(search_tree_multiset__methods, randomized_against_std_multiset) {
+	search_tree_multimap mst;
+	std::multimap<value_type, std::string> matcher;
+	std::mt19937 rng(12345);
+
+	for (size_type i = 0; i < 20000; i++) {
+		value_type key = static_cast<value_type>(rng() % 500);
+		if (rng() % 4 == 0) {
+			ASSERT_EQ(mst.erase(key), matcher.erase(key)) << i;
+		} else {
+			mst.emplace(key, std::to_string(i));
+			matcher.emplace(key, std::to_string(i));
+		}
+
+		ASSERT_EQ(mst.count(key), matcher.count(key)) << i;
+	}
+
+	ASSERT_EQ(mst.size(), matcher.size());
+	EXPECT_TRUE(std::equal(mst.cbegin(), mst.cend(), matcher.begin(), matcher.end(),
+						   [](const auto& entry, const auto& pair) {
+							   return entry.first == pair.first && entry.second == pair.second;
+						   }));
+}
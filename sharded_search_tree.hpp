@@ -0,0 +1,386 @@
+#ifndef SHARDED_SEARCH_TREE_HPP
+#define SHARDED_SEARCH_TREE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <initializer_list>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "binary_search_tree.hpp"
+
+
+namespace adt {
+
+    template<class T, std::size_t N = 16, class Allocator = std::allocator<T>>
+    class sharded_search_tree {
+        static_assert(N > 0, "adt::sharded_search_tree error: at least one shard is required");
+
+    public:
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        using tree_type = binary_search_tree<T, Allocator>;
+
+        using value_type = typename tree_type::value_type;
+
+        using allocator_type = typename tree_type::allocator_type;
+
+        using size_type = typename tree_type::size_type;
+
+        using const_reference = typename tree_type::const_reference;
+
+    protected:
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        // One range of keys, guarded by its own lock and kept on its own cache lines
+        struct alignas(64) _Shard : tree_type {
+            using _Node = typename tree_type::_Node;
+
+            mutable std::mutex mutex;
+
+            // The shard's size, readable without taking its lock
+            std::atomic<size_type> count = 0;
+
+            [[nodiscard]] bool _contains_value(const_reference value) const noexcept {
+                return tree_type::_find_target(value, this->root) != nullptr;
+            }
+
+            bool _erase_value(const_reference value) noexcept {
+                _Node* target = tree_type::_find_target(value, this->root);
+                if (target == nullptr) {
+                    return false;
+                }
+
+                tree_type::_erase(target);
+
+                return true;
+            }
+
+            template<class Function>
+            void _visit(const value_type* lower, const value_type* upper, Function& function) const {
+                const _Node* curr = this->min_node;
+
+                // Descend to the smallest value not less than `lower`
+                if (lower != nullptr) {
+                    curr = nullptr;
+                    for (_Node* node = this->root; node != nullptr;) {
+                        if (node->value < *lower) {
+                            node = node->right;
+                        } else {
+                            curr = node;
+                            node = node->left;
+                        }
+                    }
+                }
+
+                // Visit values in order until `upper` is reached
+                while (curr != nullptr && (upper == nullptr || curr->value < *upper)) {
+                    function(curr->value);
+                    curr = tree_type::_find_successor(const_cast<_Node*>(curr));
+                }
+            }
+        };
+
+        // Operations announce themselves in one of these slots so that a rebalance can wait for them to drain
+        struct alignas(64) reader_slot {
+            std::atomic<size_type> active = 0;
+        };
+
+        // Holds a reader slot for its lifetime, so an operation that throws still lets a rebalance go ahead
+        struct _Admission {
+            reader_slot& slot;
+
+            explicit _Admission(const sharded_search_tree& tree) noexcept : slot(tree._enter()) {}
+
+            _Admission(const _Admission&) = delete;
+
+            ~_Admission() noexcept { sharded_search_tree::_leave(this->slot); }
+        };
+
+        // Keeps operations out for its lifetime and always lets them back in, even if the work in between throws
+        struct _Exclusion {
+            sharded_search_tree& tree;
+
+            explicit _Exclusion(sharded_search_tree& tree) noexcept : tree(tree) { this->tree._exclude(); }
+
+            _Exclusion(const _Exclusion&) = delete;
+
+            ~_Exclusion() noexcept { this->tree._readmit(); }
+        };
+
+        /* ------------------------------------------------Fields--------------------------------------------------- */
+        static constexpr size_type reader_slots = 64;
+
+        // A shard is checked for skew each time its size reaches a multiple of this
+        static constexpr size_type rebalance_floor = 1024;
+
+        // A shard holding more than this many times its fair share triggers a rebalance
+        static constexpr size_type rebalance_skew = 2;
+
+        std::array<_Shard, N> shards;
+
+        // Shard i holds the values in [splitters[i - 1], splitters[i]); fewer than N - 1 splitters leave the
+        // last shards empty
+        std::vector<value_type> splitters;
+
+        mutable reader_slot readers[reader_slots];
+
+        std::atomic<bool> rebalancing;
+
+        std::mutex rebalance_mutex;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        static size_type _slot_index() noexcept {
+            static std::atomic<size_type> next = 0;
+            thread_local size_type index = next.fetch_add(1, std::memory_order_relaxed) % reader_slots;
+            return index;
+        }
+
+        reader_slot& _enter() const noexcept {
+            reader_slot& slot = this->readers[_slot_index()];
+
+            while (true) {
+                // Announce the operation, then back off if the shard layout is being changed
+                slot.active.fetch_add(1, std::memory_order_seq_cst);
+                if (!this->rebalancing.load(std::memory_order_seq_cst)) {
+                    return slot;
+                }
+
+                slot.active.fetch_sub(1, std::memory_order_release);
+                while (this->rebalancing.load(std::memory_order_acquire)) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        static void _leave(reader_slot& slot) noexcept { slot.active.fetch_sub(1, std::memory_order_release); }
+
+        void _exclude() noexcept {
+            this->rebalancing.store(true, std::memory_order_seq_cst);
+
+            // Wait for every operation that started before the flag was raised
+            for (const reader_slot& slot : this->readers) {
+                while (slot.active.load(std::memory_order_acquire) != 0) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        void _readmit() noexcept { this->rebalancing.store(false, std::memory_order_release); }
+
+        [[nodiscard]] size_type _shard_index(const_reference value) const noexcept {
+            return std::upper_bound(this->splitters.begin(), this->splitters.end(), value) - this->splitters.begin();
+        }
+
+        void _repartition() {
+            std::vector<value_type> values;
+            values.reserve(this->size());
+
+            // Shards cover consecutive ranges, so visiting them in order yields every value in order
+            auto gather = [&values](const_reference value) { values.push_back(value); };
+            for (_Shard& shard : this->shards) {
+                shard._visit(nullptr, nullptr, gather);
+            }
+
+            // Split the values into N equal runs and build a balanced BST from each run. The new layout is built on
+            // the side, so a failure part way through leaves the shards as they were
+            std::vector<value_type> splitters;
+            std::array<tree_type, N> rebuilt;
+            for (size_type i = 0; i < N; i++) {
+                auto first = values.begin() + i * values.size() / N;
+                auto last = values.begin() + (i + 1) * values.size() / N;
+
+                if (i > 0 && first != values.end()) {
+                    splitters.push_back(*first);
+                }
+
+                rebuilt[i] = tree_type(bst_sorted_unique, first, last);
+            }
+
+            // Nothing from here on can throw; the old shard contents are freed along with `rebuilt`
+            this->splitters.swap(splitters);
+            for (size_type i = 0; i < N; i++) {
+                this->shards[i].swap(rebuilt[i]);
+                this->shards[i].count.store(this->shards[i].size(), std::memory_order_relaxed);
+            }
+        }
+
+        void _rebalance_if_skewed(size_type count) {
+            // Another thread is already rebalancing
+            std::unique_lock<std::mutex> lock(this->rebalance_mutex, std::try_to_lock);
+            if (!lock.owns_lock()) {
+                return;
+            }
+
+            if (count * N > rebalance_skew * this->size()) {
+                _Exclusion exclusion(*this);
+                this->_repartition();
+            }
+        }
+
+    public:
+        /* ---------------------------------------------Constructors------------------------------------------------ */
+        sharded_search_tree() noexcept : rebalancing(false) {}
+
+        template<std::input_iterator InputIt>
+        sharded_search_tree(InputIt first, InputIt last) : sharded_search_tree() {
+            for (InputIt it = first; it != last; ++it) {
+                this->shards[0].insert(*it);
+            }
+            this->shards[0].count.store(this->shards[0].size(), std::memory_order_relaxed);
+
+            this->_repartition();
+        }
+
+        sharded_search_tree(std::initializer_list<value_type> values)
+            : sharded_search_tree(values.begin(), values.end()) {}
+
+        sharded_search_tree(const sharded_search_tree& other) = delete;
+
+        sharded_search_tree(sharded_search_tree&& other) = delete;
+
+        /* ------------------------------------------Overloaded Operators------------------------------------------- */
+        sharded_search_tree& operator=(const sharded_search_tree& rhs) = delete;
+
+        sharded_search_tree& operator=(sharded_search_tree&& rhs) = delete;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        [[nodiscard]] static constexpr size_type shard_count() noexcept { return N; }
+
+        [[nodiscard]] size_type size() const noexcept {
+            // Exact when no writer is running; otherwise each shard is counted at a different moment
+            size_type size = 0;
+            for (const _Shard& shard : this->shards) {
+                size += shard.count.load(std::memory_order_relaxed);
+            }
+
+            return size;
+        }
+
+        [[nodiscard]] bool empty() const noexcept { return this->size() == 0; }
+
+        [[nodiscard]] std::array<size_type, N> shard_sizes() const noexcept {
+            std::array<size_type, N> sizes;
+            for (size_type i = 0; i < N; i++) {
+                sizes[i] = this->shards[i].count.load(std::memory_order_relaxed);
+            }
+
+            return sizes;
+        }
+
+        [[nodiscard]] bool contains(const_reference value) const {
+            _Admission admission(*this);
+            const _Shard& shard = this->shards[this->_shard_index(value)];
+
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            return shard._contains_value(value);
+        }
+
+        [[nodiscard]] size_type count(const_reference value) const { return this->contains(value) ? 1 : 0; }
+
+        bool insert(const_reference value) {
+            bool inserted;
+            size_type count;
+            {
+                _Admission admission(*this);
+                _Shard& shard = this->shards[this->_shard_index(value)];
+
+                std::lock_guard<std::mutex> lock(shard.mutex);
+                inserted = shard.insert(value).second;
+                count = shard.size();
+                shard.count.store(count, std::memory_order_relaxed);
+            }
+
+            // Keys that drift into one shard undo the partitioning; check for skew every so often
+            if (inserted && count % rebalance_floor == 0) {
+                this->_rebalance_if_skewed(count);
+            }
+
+            return inserted;
+        }
+
+        size_type erase(const_reference value) {
+            _Admission admission(*this);
+            _Shard& shard = this->shards[this->_shard_index(value)];
+
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            bool erased = shard._erase_value(value);
+            shard.count.store(shard.size(), std::memory_order_relaxed);
+
+            return erased ? 1 : 0;
+        }
+
+        void clear() {
+            std::lock_guard<std::mutex> lock(this->rebalance_mutex);
+
+            _Exclusion exclusion(*this);
+            for (_Shard& shard : this->shards) {
+                shard.clear();
+                shard.count.store(0, std::memory_order_relaxed);
+            }
+            this->splitters.clear();
+        }
+
+        void rebalance() {
+            std::lock_guard<std::mutex> lock(this->rebalance_mutex);
+
+            _Exclusion exclusion(*this);
+            this->_repartition();
+        }
+
+        template<class Function>
+        void for_each(Function function) const {
+            _Admission admission(*this);
+
+            // Each shard is visited under its own lock, so writers to other shards are not held up
+            for (const _Shard& shard : this->shards) {
+                std::lock_guard<std::mutex> lock(shard.mutex);
+                shard._visit(nullptr, nullptr, function);
+            }
+        }
+
+        [[nodiscard]] std::vector<value_type> range(const_reference lower, const_reference upper) const {
+            std::vector<value_type> values;
+            auto collect = [&values](const_reference value) { values.push_back(value); };
+
+            if (!(lower < upper)) {
+                return values;
+            }
+
+            // Only the shards whose ranges overlap [lower, upper) are visited
+            {
+                _Admission admission(*this);
+                size_type last = this->_shard_index(upper);
+                for (size_type i = this->_shard_index(lower); i <= last && i < N; i++) {
+                    std::lock_guard<std::mutex> lock(this->shards[i].mutex);
+                    this->shards[i]._visit(&lower, &upper, collect);
+                }
+            }
+
+            return values;
+        }
+
+        [[nodiscard]] tree_type snapshot() {
+            std::lock_guard<std::mutex> lock(this->rebalance_mutex);
+            std::vector<value_type> values;
+            auto gather = [&values](const_reference value) { values.push_back(value); };
+
+            // Keep every writer out so that the copy is consistent across shards
+            {
+                _Exclusion exclusion(*this);
+                for (const _Shard& shard : this->shards) {
+                    shard._visit(nullptr, nullptr, gather);
+                }
+            }
+
+            return tree_type(bst_sorted_unique, values.begin(), values.end());
+        }
+    };
+} // adt
+
+
+#endif // SHARDED_SEARCH_TREE_HPP
@@ -0,0 +1,212 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <compare>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "sharded_search_tree.hpp"
+
+/* --------------------------------------------Definitions--------------------------------------------------- */
+using value_type = int;
+
+using size_type = std::size_t;
+
+using sharded_search_tree = adt::sharded_search_tree<value_type, 4>;
+
+// A value whose copies start failing once a budget runs out, to force allocation failures in a repartition
+struct fragile_value {
+	static inline size_type copies_left = static_cast<size_type>(-1);
+
+	value_type value;
+
+	fragile_value(value_type value) noexcept : value(value) {}
+
+	fragile_value(const fragile_value& other) : value(other.value) {
+		if (copies_left == 0) {
+			throw std::bad_alloc();
+		}
+		copies_left--;
+	}
+
+	fragile_value& operator=(const fragile_value& rhs) = default;
+
+	friend bool operator==(const fragile_value& lhs, const fragile_value& rhs) noexcept = default;
+
+	friend auto operator<=>(const fragile_value& lhs, const fragile_value& rhs) noexcept = default;
+};
+
+/* ---------------------------------------------Variables---------------------------------------------------- */
+constexpr std::initializer_list<value_type> sharded_init = {50, 30, 70, 20, 40, 60, 80, 10, 25, 35, 45, 55, 65};
+
+constexpr std::initializer_list<value_type> sharded_matcher = {10, 20, 25, 30, 35, 40, 45, 50, 55, 60, 65, 70, 80};
+
+/* --------------------------------------Sharded Search Tree Tests------------------------------------------- */
+TEST(sharded_search_tree__constructors, default_constructor) {
+	sharded_search_tree sst;
+
+	EXPECT_TRUE(sst.empty());
+	EXPECT_EQ(sst.size(), 0);
+	EXPECT_FALSE(sst.contains(101));
+	EXPECT_TRUE(sst.range(0, 100).empty());
+}
+
+TEST(sharded_search_tree__constructors, initializer_list_constructor) {
+	sharded_search_tree sst = sharded_init;
+	std::array<size_type, 4> sizes = sst.shard_sizes();
+
+	EXPECT_EQ(sst.size(), sharded_matcher.size());
+	EXPECT_THAT(sizes, ::testing::ElementsAre(3, 3, 3, 4));
+	for (value_type value : sharded_init) {
+		EXPECT_TRUE(sst.contains(value));
+	}
+}
+
+TEST(sharded_search_tree__methods, insert_and_erase) {
+	sharded_search_tree sst = sharded_init;
+
+	// Keys below the first splitter and above the last one land in the outer shards
+	EXPECT_TRUE(sst.insert(5));
+	EXPECT_TRUE(sst.insert(90));
+	EXPECT_FALSE(sst.insert(50));
+	EXPECT_EQ(sst.count(5), 1);
+	EXPECT_EQ(sst.shard_sizes().front(), 4);
+	EXPECT_EQ(sst.shard_sizes().back(), 5);
+
+	EXPECT_EQ(sst.erase(30), 1);
+	EXPECT_EQ(sst.erase(30), 0);
+	EXPECT_FALSE(sst.contains(30));
+	EXPECT_EQ(sst.size(), sharded_matcher.size() + 1);
+}
+
+TEST(sharded_search_tree__methods, for_each__ordered_across_shards) {
+	sharded_search_tree sst = sharded_init;
+	std::vector<value_type> values;
+
+	sst.for_each([&values](value_type value) { values.push_back(value); });
+
+	EXPECT_THAT(values, ::testing::ElementsAreArray(sharded_matcher));
+}
+
+TEST(sharded_search_tree__methods, range__across_shards) {
+	sharded_search_tree sst = sharded_init;
+
+	EXPECT_THAT(sst.range(22, 61), ::testing::ElementsAre(25, 30, 35, 40, 45, 50, 55, 60));
+	EXPECT_THAT(sst.range(0, 11), ::testing::ElementsAre(10));
+	EXPECT_THAT(sst.range(65, 1000), ::testing::ElementsAre(65, 70, 80));
+	EXPECT_TRUE(sst.range(61, 61).empty());
+	EXPECT_TRUE(sst.range(81, 0).empty());
+}
+
+TEST(sharded_search_tree__methods, rebalance__on_drift) {
+	sharded_search_tree sst;
+
+	// Ascending keys all fall past the last splitter, so the last shard keeps growing until it is split up
+	for (value_type value = 0; value < 20000; value++) {
+		sst.insert(value);
+	}
+
+	std::array<size_type, 4> sizes = sst.shard_sizes();
+	EXPECT_EQ(sst.size(), 20000);
+	EXPECT_LE(*std::max_element(sizes.begin(), sizes.end()), 2 * 20000 / 4);
+	EXPECT_GT(*std::min_element(sizes.begin(), sizes.end()), 0);
+
+	sst.rebalance();
+	EXPECT_THAT(sst.shard_sizes(), ::testing::Each(5000));
+	EXPECT_THAT(sst.range(4998, 5002), ::testing::ElementsAre(4998, 4999, 5000, 5001));
+}
+
+TEST(sharded_search_tree__methods, rebalance__failure_leaves_shards_intact) {
+	adt::sharded_search_tree<fragile_value, 4> sst;
+	for (value_type value = 0; value < 100; value++) {
+		sst.insert(value);
+	}
+	std::array<size_type, 4> sizes = sst.shard_sizes();
+
+	// Fail once the values have been gathered and the new shards are part way built, then once while gathering
+	for (size_type budget : {size_type(150), size_type(10)}) {
+		fragile_value::copies_left = budget;
+		EXPECT_THROW(sst.rebalance(), std::bad_alloc);
+		fragile_value::copies_left = static_cast<size_type>(-1);
+
+		// Operations are let back in, and every value is still where it was
+		EXPECT_EQ(sst.shard_sizes(), sizes);
+		for (value_type value = 0; value < 100; value++) {
+			ASSERT_TRUE(sst.contains(value));
+		}
+	}
+
+	EXPECT_TRUE(sst.insert(100));
+	sst.rebalance();
+	EXPECT_THAT(sst.shard_sizes(), ::testing::Each(::testing::Ge(25)));
+}
+
+TEST(sharded_search_tree__methods, throwing_reads__release_their_slot) {
+	adt::sharded_search_tree<fragile_value, 4> sst;
+	for (value_type value = 0; value < 100; value++) {
+		sst.insert(value);
+	}
+	sst.rebalance();
+
+	// A visitor that throws, and a range whose copies run out, must not leave a slot held
+	EXPECT_THROW(sst.for_each([](const fragile_value& value) {
+		if (value.value == 60) {
+			throw std::runtime_error("visitor failed");
+		}
+	}), std::runtime_error);
+
+	fragile_value::copies_left = 5;
+	EXPECT_THROW(static_cast<void>(sst.range(10, 90)), std::bad_alloc);
+	fragile_value::copies_left = static_cast<size_type>(-1);
+
+	// Otherwise these would wait forever for the slots to drain
+	sst.rebalance();
+	EXPECT_EQ(sst.snapshot().size(), 100);
+	sst.clear();
+	EXPECT_TRUE(sst.empty());
+}
+
+TEST(sharded_search_tree__methods, snapshot_and_clear) {
+	sharded_search_tree sst = sharded_init;
+
+	adt::binary_search_tree<value_type> bst = sst.snapshot();
+	EXPECT_TRUE(std::equal(bst.cbegin(), bst.cend(), sharded_matcher.begin(), sharded_matcher.end()));
+
+	sst.clear();
+	EXPECT_TRUE(sst.empty());
+	EXPECT_FALSE(sst.contains(50));
+	EXPECT_TRUE(sst.insert(50));
+	EXPECT_EQ(sst.shard_sizes().front(), 1);
+}
+
+TEST(sharded_search_tree__methods, concurrent_writers) {
+	sharded_search_tree sst;
+	std::vector<std::thread> writers;
+
+	// Writers start on one shard and race with the rebalances their inserts trigger
+	for (size_type t = 0; t < 4; t++) {
+		writers.emplace_back([&sst, t] {
+			for (value_type value = t; value < 40000; value += 4) {
+				sst.insert(value);
+			}
+			for (value_type value = t; value < 40000; value += 8) {
+				sst.erase(value);
+			}
+		});
+	}
+
+	for (std::thread& writer : writers) {
+		writer.join();
+	}
+
+	std::vector<value_type> values;
+	sst.for_each([&values](value_type value) { values.push_back(value); });
+
+	EXPECT_EQ(sst.size(), 20000);
+	ASSERT_EQ(values.size(), 20000);
+	EXPECT_TRUE(std::is_sorted(values.begin(), values.end()));
+	EXPECT_TRUE(std::all_of(values.begin(), values.end(), [](value_type value) { return value % 8 >= 4; }));
+}
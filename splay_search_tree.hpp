@@ -0,0 +1,210 @@
+#ifndef SPLAY_SEARCH_TREE_HPP
+#define SPLAY_SEARCH_TREE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+
+#include "binary_search_tree.hpp"
+
+
+namespace adt {
+
+    // A binary_search_tree that splays on access. find(), contains(), lower_bound(), insert() and emplace() on a
+    // non-const tree rotate the node they reach up to the root, so frequently read keys stay near the top and a
+    // skewed workload runs in amortized O(log n) per operation regardless of insertion order. Rotations only
+    // relink nodes, so iterators stay valid. The const overloads descend without restructuring anything, for
+    // callers that need a read-only lookup
+    template<class T, class Allocator = std::allocator<T>>
+    class splay_search_tree : public binary_search_tree<T, Allocator> {
+    public:
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        using tree_type = binary_search_tree<T, Allocator>;
+
+        using value_type = typename tree_type::value_type;
+
+        using allocator_type = typename tree_type::allocator_type;
+
+        using size_type = typename tree_type::size_type;
+
+        using const_reference = typename tree_type::const_reference;
+
+        using iterator = typename tree_type::iterator;
+
+        using const_iterator = typename tree_type::const_iterator;
+
+    protected:
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        using _Node = typename tree_type::_Node;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        constexpr void _rotate_up(_Node* node) noexcept {
+            // Rotate `node` above its parent, keeping the in-order sequence intact
+            _Node* parent = node->parent;
+            _Node* grandparent = parent->parent;
+            if (node == parent->left) {
+                parent->left = node->right;
+                if (node->right != nullptr) {
+                    node->right->parent = parent;
+                }
+                node->right = parent;
+            } else {
+                parent->right = node->left;
+                if (node->left != nullptr) {
+                    node->left->parent = parent;
+                }
+                node->left = parent;
+            }
+
+            parent->parent = node;
+            node->parent = grandparent;
+            if (grandparent == nullptr) {
+                this->root = node;
+            } else if (grandparent->left == parent) {
+                grandparent->left = node;
+            } else {
+                grandparent->right = node;
+            }
+        }
+
+        constexpr void _splay(_Node* node) noexcept {
+            if (node == nullptr) {
+                return;
+            }
+
+            while (node->parent != nullptr) {
+                _Node* parent = node->parent;
+                _Node* grandparent = parent->parent;
+                if (grandparent == nullptr) {
+                    // Zig: the parent is the root
+                    this->_rotate_up(node);
+                } else if ((node == parent->left) == (parent == grandparent->left)) {
+                    // Zig-zig: rotating the parent first is what halves the depth of the whole access path
+                    this->_rotate_up(parent);
+                    this->_rotate_up(node);
+                } else {
+                    // Zig-zag
+                    this->_rotate_up(node);
+                    this->_rotate_up(node);
+                }
+            }
+        }
+
+        _Node* _find_node(const_reference value, _Node*& last) const noexcept {
+            // Descend towards `value`, remembering the last node visited so that a miss can still be splayed
+            last = nullptr;
+            for (_Node* curr = this->root; curr != nullptr;) {
+                last = curr;
+                if (value < curr->value) {
+                    curr = curr->left;
+                } else if (curr->value < value) {
+                    curr = curr->right;
+                } else {
+                    return curr;
+                }
+            }
+
+            return nullptr;
+        }
+
+        _Node* _lower_bound(const_reference value, _Node*& last) const noexcept {
+            // The leftmost node that is not less than `value`
+            _Node* bound = nullptr;
+            last = nullptr;
+            for (_Node* curr = this->root; curr != nullptr;) {
+                last = curr;
+                if (curr->value < value) {
+                    curr = curr->right;
+                } else {
+                    bound = curr;
+                    curr = curr->left;
+                }
+            }
+
+            return bound;
+        }
+
+    public:
+        /* ---------------------------------------------Constructors------------------------------------------------ */
+        splay_search_tree() noexcept : tree_type() {}
+
+        explicit splay_search_tree(const allocator_type& allocator) noexcept : tree_type(allocator) {}
+
+        splay_search_tree(std::initializer_list<value_type> values) : tree_type(values) {}
+
+        // `first` to `last` must be sorted and hold no duplicates; the BST starts out balanced
+        template<std::random_access_iterator RandomIt>
+        splay_search_tree(bst_sorted_unique_t tag, RandomIt first, RandomIt last) : tree_type(tag, first, last) {}
+
+        splay_search_tree(const splay_search_tree& other) = default;
+
+        splay_search_tree(splay_search_tree&& other) noexcept = default;
+
+        /* -----------------------------------------------Destructor------------------------------------------------ */
+        virtual ~splay_search_tree() noexcept override = default;
+
+        /* ------------------------------------------Overloaded Operators------------------------------------------- */
+        splay_search_tree& operator=(const splay_search_tree& rhs) = default;
+
+        splay_search_tree& operator=(splay_search_tree&& rhs) noexcept = default;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        // The hinted, range and node handle overloads insert without splaying
+        using tree_type::insert;
+
+        std::pair<iterator, bool> insert(const_reference value) {
+            std::pair<_Node*, bool> pair = this->_insert(value);
+            this->_splay(pair.first);
+            return std::make_pair(this->_make_iterator(pair.first), pair.second);
+        }
+
+        std::pair<iterator, bool> insert(value_type&& value) {
+            std::pair<_Node*, bool> pair = this->_insert(std::move(value));
+            this->_splay(pair.first);
+            return std::make_pair(this->_make_iterator(pair.first), pair.second);
+        }
+
+        template<class... Args>
+        std::pair<iterator, bool> emplace(Args&&... args) {
+            std::pair<_Node*, bool> pair = this->_emplace(nullptr, std::forward<Args>(args)...);
+            this->_splay(pair.first);
+            return std::make_pair(this->_make_iterator(pair.first), pair.second);
+        }
+
+        [[nodiscard]] iterator find(const_reference value) noexcept {
+            _Node* last;
+            _Node* node = this->_find_node(value, last);
+            this->_splay((node != nullptr) ? node : last);
+            return this->_make_iterator(node);
+        }
+
+        [[nodiscard]] const_iterator find(const_reference value) const noexcept {
+            _Node* last;
+            return this->_make_const_iterator(this->_find_node(value, last));
+        }
+
+        [[nodiscard]] bool contains(const_reference value) noexcept { return this->find(value) != this->end(); }
+
+        [[nodiscard]] virtual bool contains(const_reference value) const noexcept override {
+            _Node* last;
+            return this->_find_node(value, last) != nullptr;
+        }
+
+        [[nodiscard]] iterator lower_bound(const_reference value) noexcept {
+            _Node* last;
+            _Node* bound = this->_lower_bound(value, last);
+            this->_splay((bound != nullptr) ? bound : last);
+            return this->_make_iterator(bound);
+        }
+
+        [[nodiscard]] const_iterator lower_bound(const_reference value) const noexcept {
+            _Node* last;
+            return this->_make_const_iterator(this->_lower_bound(value, last));
+        }
+    };
+} // adt
+
+
+#endif // SPLAY_SEARCH_TREE_HPP
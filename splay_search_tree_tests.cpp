@@ -0,0 +1,133 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "splay_search_tree.hpp"
+
+/* --------------------------------------------Definitions--------------------------------------------------- */
+using value_type = int;
+
+using size_type = std::size_t;
+
+using splay_search_tree = adt::splay_search_tree<value_type>;
+
+/* ---------------------------------------------Variables---------------------------------------------------- */
+constexpr std::initializer_list<value_type> splay_init = {50, 30, 70, 20, 40, 60, 80, 10, 25, 35, 45, 55, 65};
+
+constexpr std::initializer_list<value_type> splay_matcher = {10, 20, 25, 30, 35, 40, 45, 50, 55, 60, 65, 70, 80};
+
+/* ---------------------------------------------Functions---------------------------------------------------- */
+value_type splay_root(const splay_search_tree& sst) {
+	// The first node of a preorder traversal is the root
+	return *sst.cbegin(adt::bst_traversals::preorder);
+}
+
+/* ----------------------------------------Splay Search Tree Tests------------------------------------------- */
+TEST(splay_search_tree__constructors, initializer_list_constructor) {
+	splay_search_tree sst = splay_init;
+
+	EXPECT_EQ(sst.size(), splay_matcher.size());
+	EXPECT_EQ(sst, splay_matcher);
+	EXPECT_EQ(splay_root(sst), 50);
+}
+
+TEST(splay_search_tree__methods, find__splays_to_root) {
+	splay_search_tree sst = splay_init;
+
+	// A hit moves the node found to the root, without changing the in-order sequence or the extremes
+	splay_search_tree::iterator it = sst.find(25);
+	ASSERT_NE(it, sst.end());
+	EXPECT_EQ(*it, 25);
+	EXPECT_EQ(splay_root(sst), 25);
+	EXPECT_EQ(sst, splay_matcher);
+	EXPECT_EQ(sst.peek_min(), 10);
+	EXPECT_EQ(sst.peek_max(), 80);
+
+	// A miss moves the last node on the search path to the root
+	EXPECT_EQ(sst.find(62), sst.end());
+	EXPECT_TRUE(splay_root(sst) == 60 || splay_root(sst) == 65);
+	EXPECT_EQ(sst, splay_matcher);
+
+	// Iterators stay valid across splays
+	EXPECT_TRUE(sst.contains(80));
+	EXPECT_EQ(splay_root(sst), 80);
+	EXPECT_EQ(*it, 25);
+	EXPECT_EQ(*++it, 30);
+}
+
+TEST(splay_search_tree__methods, const_lookups__do_not_splay) {
+	splay_search_tree sst = splay_init;
+	const splay_search_tree& csst = sst;
+
+	EXPECT_EQ(*csst.find(65), 65);
+	EXPECT_TRUE(csst.contains(10));
+	EXPECT_FALSE(csst.contains(11));
+	EXPECT_EQ(*csst.lower_bound(56), 60);
+	EXPECT_EQ(csst.lower_bound(81), csst.cend());
+
+	EXPECT_EQ(splay_root(sst), 50);
+}
+
+TEST(splay_search_tree__methods, insert_and_lower_bound__splay_to_root) {
+	splay_search_tree sst = splay_init;
+
+	EXPECT_TRUE(sst.insert(33).second);
+	EXPECT_EQ(splay_root(sst), 33);
+
+	// A duplicate is not inserted, but the existing node is still brought up
+	EXPECT_FALSE(sst.insert(70).second);
+	EXPECT_EQ(splay_root(sst), 70);
+
+	EXPECT_TRUE(sst.emplace(90).second);
+	EXPECT_EQ(splay_root(sst), 90);
+	EXPECT_EQ(sst.peek_max(), 90);
+
+	EXPECT_EQ(*sst.lower_bound(41), 45);
+	EXPECT_EQ(splay_root(sst), 45);
+	EXPECT_EQ(sst.lower_bound(91), sst.end());
+	EXPECT_EQ(sst.size(), splay_matcher.size() + 2);
+}
+
+TEST(splay_search_tree__methods, randomized_against_std_set) {
+	std::mt19937 rng(12345);
+	std::set<value_type> set;
+	splay_search_tree sst;
+
+	// Mix inserts, lookups and erasures so the tree is reshaped constantly
+	for (size_type i = 0; i < 20000; i++) {
+		value_type value = static_cast<value_type>(rng() % 2000);
+		switch (rng() % 4) {
+			case 0:
+				ASSERT_EQ(sst.insert(value).second, set.insert(value).second);
+				break;
+			case 1:
+				ASSERT_EQ(sst.contains(value), set.contains(value));
+				break;
+			case 2: {
+				auto lower = set.lower_bound(value);
+				splay_search_tree::iterator it = sst.lower_bound(value);
+				ASSERT_EQ(it == sst.end(), lower == set.end());
+				if (lower != set.end()) {
+					ASSERT_EQ(*it, *lower);
+				}
+				break;
+			}
+			default:
+				if (splay_search_tree::iterator it = sst.find(value); it != sst.end()) {
+					sst.erase(it);
+					set.erase(value);
+				}
+		}
+	}
+
+	ASSERT_EQ(sst.size(), set.size());
+	EXPECT_TRUE(std::equal(sst.cbegin(), sst.cend(), set.begin(), set.end()));
+	if (!set.empty()) {
+		EXPECT_EQ(sst.peek_min(), *set.begin());
+		EXPECT_EQ(sst.peek_max(), *set.rbegin());
+	}
+}
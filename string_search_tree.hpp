@@ -0,0 +1,382 @@
+#ifndef STRING_SEARCH_TREE_HPP
+#define STRING_SEARCH_TREE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "binary_search_tree.hpp"
+
+
+namespace adt {
+
+    // An immutable ordered set of strings stored with front coding. Keys are kept in order in blocks of up to
+    // `BlockSize`; each block starts with its key written out in full, and every later key stores only the length
+    // of the prefix it shares with the key before it plus the remaining suffix. Searches track how much of the
+    // query is already known to match, so no comparison re-scans a common prefix
+    template<std::size_t BlockSize = 16>
+    class string_search_tree {
+    public:
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        using value_type = std::string;
+
+        using size_type = std::size_t;
+
+        using difference_type = std::ptrdiff_t;
+
+        using const_reference = const value_type&;
+
+        static_assert(BlockSize > 0, "adt::string_search_tree error: blocks must hold at least one key");
+
+    protected:
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        using _Traits = std::char_traits<char>;
+
+        // An encoded key: the length of the prefix it shares with the previous key, then its own suffix
+        struct _Entry {
+            size_type shared;
+
+            std::string_view suffix;
+
+            // Where the following key starts
+            size_type next;
+        };
+
+        /* ------------------------------------------------Fields--------------------------------------------------- */
+        // Where every block's first key starts in `bytes`; a block's first key always shares nothing
+        std::vector<size_type> block_offset;
+
+        std::vector<char> bytes;
+
+        size_type sz = 0;
+
+        std::string last_key;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        void _write_varint(size_type value) {
+            while (value >= 0x80) {
+                this->bytes.push_back(static_cast<char>(value | 0x80));
+                value >>= 7;
+            }
+            this->bytes.push_back(static_cast<char>(value));
+        }
+
+        size_type _read_varint(size_type& offset) const noexcept {
+            size_type value = 0;
+            unsigned int shift = 0;
+            unsigned char byte;
+            do {
+                byte = static_cast<unsigned char>(this->bytes[offset++]);
+                value |= static_cast<size_type>(byte & 0x7f) << shift;
+                shift += 7;
+            } while (byte & 0x80);
+
+            return value;
+        }
+
+        _Entry _decode(size_type offset) const noexcept {
+            size_type shared = this->_read_varint(offset);
+            size_type length = this->_read_varint(offset);
+
+            return _Entry{shared, std::string_view(this->bytes.data() + offset, length), offset + length};
+        }
+
+        void _append(std::string_view key) {
+            size_type shared = 0;
+            if (this->sz % BlockSize == 0) {
+                this->block_offset.push_back(this->bytes.size());
+            } else {
+                shared = _mismatch(this->last_key, key, 0);
+            }
+
+            this->_write_varint(shared);
+            this->_write_varint(key.size() - shared);
+            this->bytes.insert(this->bytes.end(), key.begin() + shared, key.end());
+
+            this->last_key.assign(key);
+            this->sz++;
+        }
+
+        template<std::input_iterator InputIt>
+        void _build(InputIt first, InputIt last) {
+            for (; first != last; ++first) {
+                this->_append(*first);
+            }
+
+            // Keys are only appended while building, so trim the encoded bytes and drop the key the last one was
+            // front-coded against
+            this->block_offset.shrink_to_fit();
+            this->bytes.shrink_to_fit();
+            this->last_key = std::string();
+        }
+
+        static size_type _mismatch(std::string_view lhs, std::string_view rhs, size_type from) noexcept {
+            // The length of the common prefix, given that the first `from` characters are known to match
+            size_type limit = std::min(lhs.size(), rhs.size());
+            while (from < limit && _Traits::eq(lhs[from], rhs[from])) {
+                from++;
+            }
+
+            return from;
+        }
+
+        static int _compare(std::string_view lhs, std::string_view rhs, size_type common) noexcept {
+            // Order two strings that share exactly `common` leading characters
+            if (common < lhs.size() && common < rhs.size()) {
+                return _Traits::lt(lhs[common], rhs[common]) ? -1 : 1;
+            }
+
+            return (lhs.size() < rhs.size()) ? -1 : (lhs.size() > rhs.size()) ? 1 : 0;
+        }
+
+        size_type _lower_bound(std::string_view query, bool& found) const noexcept {
+            found = false;
+            if (this->sz == 0) {
+                return this->bytes.size();
+            }
+
+            // Binary search for the last block whose first key is not greater than `query`. Every key between two
+            // block keys shares at least as much of `query` as both of them do, so comparisons skip that much
+            size_type lo = 0;
+            size_type hi = this->block_offset.size();
+            size_type lo_match = 0;
+            size_type hi_match = 0;
+
+            std::string_view first = this->_decode(this->block_offset[0]).suffix;
+            lo_match = _mismatch(query, first, 0);
+            if (_compare(query, first, lo_match) < 0) {
+                return 0;
+            }
+
+            while (hi - lo > 1) {
+                size_type mid = lo + (hi - lo) / 2;
+                std::string_view key = this->_decode(this->block_offset[mid]).suffix;
+                size_type match = _mismatch(query, key, std::min(lo_match, hi_match));
+
+                if (_compare(query, key, match) < 0) {
+                    hi = mid;
+                    hi_match = match;
+                } else {
+                    lo = mid;
+                    lo_match = match;
+                }
+            }
+
+            // Scan the block, knowing how much of `query` the previous key matched
+            size_type offset = this->block_offset[lo];
+            _Entry entry = this->_decode(offset);
+            size_type match = _mismatch(query, entry.suffix, lo_match);
+            if (int order = _compare(query, entry.suffix, match); order <= 0) {
+                found = order == 0;
+                return offset;
+            }
+
+            size_type end = (lo + 1 < this->block_offset.size()) ? this->block_offset[lo + 1] : this->bytes.size();
+            for (offset = entry.next; offset < end; offset = entry.next) {
+                entry = this->_decode(offset);
+
+                // A key that shares more with the previous key than `query` does is still less than `query`, and
+                // one that shares less is already greater
+                if (entry.shared > match) {
+                    continue;
+                }
+                if (entry.shared < match) {
+                    return offset;
+                }
+
+                // Otherwise only the suffixes need to be compared
+                std::string_view rest = query.substr(match);
+                size_type common = _mismatch(rest, entry.suffix, 0);
+                if (int order = _compare(rest, entry.suffix, common); order <= 0) {
+                    found = order == 0;
+                    return offset;
+                }
+                match += common;
+            }
+
+            // Every key in the block is less than `query`, so the bound is the first key of the next block
+            return end;
+        }
+
+    public:
+        /* ---------------------------------------------Const Iterator---------------------------------------------- */
+        class const_iterator {
+        private:
+            /* --------------------------------------------Friends-------------------------------------------------- */
+            friend class string_search_tree;
+
+        public:
+            /* ------------------------------------------Definitions----------------------------------------------- */
+            using iterator_category = std::forward_iterator_tag;
+
+            using value_type = string_search_tree::value_type;
+
+            using difference_type = string_search_tree::difference_type;
+
+            using pointer = const value_type*;
+
+            using reference = const value_type&;
+
+        protected:
+            /* ---------------------------------------------Fields-------------------------------------------------- */
+            const string_search_tree* tree = nullptr;
+
+            // Where the current key is encoded; a past-the-end iterator sits at the end of the encoding
+            size_type offset = 0;
+
+            size_type next = 0;
+
+            value_type key;
+
+            /* ------------------------------------------Constructors----------------------------------------------- */
+            const_iterator(const string_search_tree* tree, size_type offset) : tree(tree), offset(offset) {
+                if (this->offset == this->tree->bytes.size()) {
+                    return;
+                }
+
+                // Rebuild the key from the start of its block
+                auto block = std::upper_bound(this->tree->block_offset.begin(), this->tree->block_offset.end(),
+                                              this->offset) - 1;
+                for (size_type curr = *block; curr <= this->offset; curr = this->next) {
+                    this->_read(curr);
+                }
+            }
+
+            /* --------------------------------------------Methods------------------------------------------------- */
+            void _read(size_type offset) {
+                _Entry entry = this->tree->_decode(offset);
+                this->key.resize(entry.shared);
+                this->key.append(entry.suffix);
+                this->next = entry.next;
+            }
+
+        public:
+            /* ------------------------------------------Constructors----------------------------------------------- */
+            const_iterator() noexcept = default;
+
+            /* ---------------------------------------Overloaded Operators------------------------------------------ */
+            [[nodiscard]] reference operator*() const noexcept { return this->key; }
+
+            [[nodiscard]] pointer operator->() const noexcept { return &this->key; }
+
+            const_iterator& operator++() {
+                // A block's first key shares nothing with the key before it, so blocks decode back to back
+                this->offset = this->next;
+                if (this->offset < this->tree->bytes.size()) {
+                    this->_read(this->offset);
+                } else {
+                    this->key.clear();
+                }
+
+                return *this;
+            }
+
+            const_iterator operator++(int) {
+                const_iterator temp = *this;
+                ++*this;
+                return temp;
+            }
+
+            [[nodiscard]] bool operator==(const const_iterator& rhs) const noexcept {
+                return this->offset == rhs.offset;
+            }
+        };
+
+        /* ---------------------------------------------Constructors------------------------------------------------ */
+        string_search_tree() noexcept = default;
+
+        // `first` to `last` must be sorted and hold no duplicates
+        template<std::input_iterator InputIt>
+        string_search_tree(bst_sorted_unique_t, InputIt first, InputIt last) {
+            this->_build(first, last);
+        }
+
+        template<class Allocator>
+        explicit string_search_tree(const binary_search_tree<std::string, Allocator>& tree) {
+            this->_build(tree.cbegin(), tree.cend());
+        }
+
+        string_search_tree(std::initializer_list<value_type> keys) {
+            std::vector<value_type> sorted(keys);
+            std::sort(sorted.begin(), sorted.end());
+            sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+
+            this->_build(sorted.begin(), sorted.end());
+        }
+
+        string_search_tree(const string_search_tree& other) = default;
+
+        string_search_tree(string_search_tree&& other) noexcept = default;
+
+        /* -----------------------------------------------Destructor------------------------------------------------ */
+        ~string_search_tree() noexcept = default;
+
+        /* ------------------------------------------Overloaded Operators------------------------------------------- */
+        string_search_tree& operator=(const string_search_tree& rhs) = default;
+
+        string_search_tree& operator=(string_search_tree&& rhs) noexcept = default;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        [[nodiscard]] const_iterator begin() const { return const_iterator(this, 0); }
+
+        [[nodiscard]] const_iterator end() const { return const_iterator(this, this->bytes.size()); }
+
+        [[nodiscard]] const_iterator cbegin() const { return this->begin(); }
+
+        [[nodiscard]] const_iterator cend() const { return this->end(); }
+
+        [[nodiscard]] size_type size() const noexcept { return this->sz; }
+
+        [[nodiscard]] bool empty() const noexcept { return this->sz == 0; }
+
+        // Bytes held by the encoded keys and the block index
+        [[nodiscard]] size_type memory_usage() const noexcept {
+            return this->block_offset.capacity() * sizeof(size_type) + this->bytes.capacity();
+        }
+
+        [[nodiscard]] const_iterator lower_bound(std::string_view key) const {
+            bool found;
+            return const_iterator(this, this->_lower_bound(key, found));
+        }
+
+        [[nodiscard]] const_iterator upper_bound(std::string_view key) const {
+            bool found;
+            const_iterator cit(this, this->_lower_bound(key, found));
+            if (found) {
+                ++cit;
+            }
+
+            return cit;
+        }
+
+        [[nodiscard]] const_iterator find(std::string_view key) const {
+            bool found;
+            size_type offset = this->_lower_bound(key, found);
+            return found ? const_iterator(this, offset) : this->end();
+        }
+
+        [[nodiscard]] bool contains(std::string_view key) const noexcept {
+            bool found;
+            this->_lower_bound(key, found);
+            return found;
+        }
+
+        [[nodiscard]] size_type count(std::string_view key) const noexcept { return this->contains(key) ? 1 : 0; }
+
+        template<class Allocator = std::allocator<std::string>>
+        [[nodiscard]] binary_search_tree<std::string, Allocator> decompress() const {
+            // Expand every front-coded key once; the keys come out sorted, so the BST is linked balanced in O(n)
+            std::vector<value_type> keys(this->begin(), this->end());
+            return binary_search_tree<std::string, Allocator>(bst_sorted_unique, keys.begin(), keys.end());
+        }
+    };
+} // adt
+
+
+#endif // STRING_SEARCH_TREE_HPP
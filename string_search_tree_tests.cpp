@@ -0,0 +1,132 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "string_search_tree.hpp"
+
+/* --------------------------------------------Definitions--------------------------------------------------- */
+using value_type = std::string;
+
+using size_type = std::size_t;
+
+using binary_search_tree = adt::binary_search_tree<value_type>;
+
+using string_search_tree = adt::string_search_tree<4>;
+
+/* ---------------------------------------------Variables---------------------------------------------------- */
+const std::vector<value_type> string_init = {
+	"/usr/lib/libc.so", "/usr/bin/ls", "/usr/lib/libm.so", "/usr", "/etc/hosts", "/usr/bin/cat", "/usr/lib",
+	"/etc/passwd", "/usr/bin/ln", "/usr/lib/libc.a", "/home", "/usr/bin", "/etc"
+};
+
+const std::vector<value_type> string_matcher = {
+	"/etc", "/etc/hosts", "/etc/passwd", "/home", "/usr", "/usr/bin", "/usr/bin/cat", "/usr/bin/ln", "/usr/bin/ls",
+	"/usr/lib", "/usr/lib/libc.a", "/usr/lib/libc.so", "/usr/lib/libm.so"
+};
+
+/* ---------------------------------------String Search Tree Tests------------------------------------------- */
+TEST(string_search_tree__constructors, default_constructor) {
+	string_search_tree sst;
+
+	EXPECT_TRUE(sst.empty());
+	EXPECT_EQ(sst.begin(), sst.end());
+	EXPECT_EQ(sst.lower_bound("/usr"), sst.end());
+	EXPECT_FALSE(sst.contains("/usr"));
+}
+
+TEST(string_search_tree__constructors, bst_constructor) {
+	binary_search_tree bst;
+	for (const value_type& key : string_init) {
+		bst.insert(key);
+	}
+	string_search_tree sst(bst);
+
+	EXPECT_EQ(sst.size(), string_matcher.size());
+	EXPECT_THAT(std::vector<value_type>(sst.begin(), sst.end()), ::testing::ElementsAreArray(string_matcher));
+
+	binary_search_tree decompressed = sst.decompress();
+	EXPECT_TRUE(std::equal(decompressed.cbegin(), decompressed.cend(), bst.cbegin(), bst.cend()));
+}
+
+TEST(string_search_tree__constructors, initializer_list_constructor) {
+	string_search_tree sst = {"b", "a", "b", "", "ab"};
+
+	EXPECT_EQ(sst.size(), 4);
+	EXPECT_THAT(std::vector<value_type>(sst.begin(), sst.end()), ::testing::ElementsAre("", "a", "ab", "b"));
+	EXPECT_TRUE(sst.contains(""));
+	EXPECT_EQ(*sst.upper_bound(""), "a");
+}
+
+TEST(string_search_tree__methods, find_and_bounds) {
+	string_search_tree sst(adt::bst_sorted_unique, string_matcher.begin(), string_matcher.end());
+
+	EXPECT_EQ(*sst.find("/usr/bin/ln"), "/usr/bin/ln");
+	EXPECT_EQ(sst.find("/usr/bin/l"), sst.end());
+	EXPECT_EQ(sst.count("/etc"), 1);
+
+	// A prefix of a key, a key with an extra suffix, and keys before and after everything
+	EXPECT_EQ(*sst.lower_bound("/usr/bin/l"), "/usr/bin/ln");
+	EXPECT_EQ(*sst.lower_bound("/usr/bin/lz"), "/usr/lib");
+	EXPECT_EQ(*sst.lower_bound("/usr/lib/libc"), "/usr/lib/libc.a");
+	EXPECT_EQ(*sst.upper_bound("/usr/lib/libc.a"), "/usr/lib/libc.so");
+	EXPECT_EQ(*sst.lower_bound(""), "/etc");
+	EXPECT_EQ(sst.lower_bound("/usr/lib/libz"), sst.end());
+	EXPECT_EQ(sst.upper_bound("/usr/lib/libm.so"), sst.end());
+
+	// Iteration picks up from a bound, across block boundaries
+	EXPECT_THAT(std::vector<value_type>(sst.lower_bound("/usr/bin/d"), sst.end()),
+				::testing::ElementsAre("/usr/bin/ln", "/usr/bin/ls", "/usr/lib", "/usr/lib/libc.a", "/usr/lib/libc.so",
+									   "/usr/lib/libm.so"));
+}
+
+TEST(string_search_tree__methods, randomized_against_std_set) {
+	std::mt19937 rng(12345);
+	std::set<value_type> set;
+
+	// Short keys over a tiny alphabet share long prefixes and are often prefixes of one another
+	auto random_key = [&rng] {
+		value_type key(rng() % 8, 'a');
+		for (char& c : key) {
+			c = static_cast<char>('a' + rng() % 3);
+		}
+		return key;
+	};
+
+	for (size_type i = 0; i < 2000; i++) {
+		set.insert(random_key());
+	}
+	adt::string_search_tree<> sst(adt::bst_sorted_unique, set.begin(), set.end());
+
+	ASSERT_EQ(sst.size(), set.size());
+	EXPECT_TRUE(std::equal(sst.begin(), sst.end(), set.begin(), set.end()));
+
+	// Neighboring keys share most of their characters, so even with two length bytes per key the encoding is
+	// smaller than the keys themselves
+	size_type length = 0;
+	for (const value_type& key : set) {
+		length += key.size();
+	}
+	EXPECT_LT(sst.memory_usage(), length);
+
+	for (size_type i = 0; i < 20000; i++) {
+		value_type key = random_key();
+		auto lower = set.lower_bound(key);
+		auto upper = set.upper_bound(key);
+		auto slower = sst.lower_bound(key);
+		auto supper = sst.upper_bound(key);
+
+		ASSERT_EQ(sst.contains(key), set.contains(key)) << key;
+		ASSERT_EQ(slower == sst.end(), lower == set.end()) << key;
+		ASSERT_EQ(supper == sst.end(), upper == set.end()) << key;
+		if (lower != set.end()) {
+			ASSERT_EQ(*slower, *lower) << key;
+		}
+		if (upper != set.end()) {
+			ASSERT_EQ(*supper, *upper) << key;
+		}
+	}
+}